@@ -38,19 +38,16 @@ _blink:
 	lsl  r2, r2, #18
 	str  r2, [r3, #0]
 
-	ldr r0, =100000
+	ldr r0, =133333       ;@ 400000 cycles ( 3 per loop )
 	bl  _delay
 
 	b   _blink
 
-/* delay function */
+/* delay function: r0 loops of 3 cycles (sub 1 + taken bne 2, code in SRAM) */
 .thumb_func
 _delay:
-	mov r4,r0
-_loop:
-	sub r4,r4,#1
-	cmp r4, #0
-	bne _loop
+	sub r0, r0, #1
+	bne _delay
 	bx  lr
 
 .align 4
@@ -8,7 +8,7 @@ int main( void ) {
 
         PUT32( 0x4000f000, ( 1 << 5 ) );               // IO BANK
 
-        while ( GET32( 0x4000c008 ) & ( 1<< 5 ) == 0 );  // Reset Done?
+        while ( ( GET32( 0x4000c008 ) & ( 1 << 5 ) ) == 0 );  // Reset Done?
 
         PUT32( 0x400140cc, 0x05 );                     // IO PAD = FUNC 5 (GPIO)
         PUT32( 0xd0000020, ( 1 << 25 ) );              // GPIO_OE
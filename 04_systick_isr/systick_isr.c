@@ -97,7 +97,7 @@ static void resetSubsys()
 {
     // Reset IO Bank
     PUT32(( RESETS_RESET | CLR ), ( 1 << 5 ) );
-    while ( GET32(RESETS_RESET_DONE ) & ( 1 << 5 ) == 0 );
+    while ( ( GET32( RESETS_RESET_DONE ) & ( 1 << 5 ) ) == 0 );
 }
 
 /* ***********************************************
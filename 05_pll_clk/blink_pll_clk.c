@@ -33,6 +33,7 @@
 #define CLK_REF_CTRL                (CLOCKS_BASE + 0x30)
 #define CLK_REF_DIV                 (CLOCKS_BASE + 0x34)
 #define CLK_SYS_CTRL                (CLOCKS_BASE + 0x3C)
+#define CLK_SYS_SELECTED            (CLOCKS_BASE + 0x44)
 #define CLK_PERI_CTRL               (CLOCKS_BASE + 0x48)
 
 // PLL_SYS
@@ -40,6 +41,7 @@
 #define PLL_SYS_CS                  (PLL_SYS_BASE + 0x00)
 #define PLL_SYS_POW                 (PLL_SYS_BASE + 0x04)
 #define PLL_SYS_FBDIV               (PLL_SYS_BASE + 0x08)
+#define PLL_SYS_PRIM                (PLL_SYS_BASE + 0x0C)
 
 /* Blink LED */
 void blinkLed(void)
@@ -58,7 +60,7 @@ __attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
 {
     // Setup LED
     PUT32( ( RESETS_RESET | CLR ), ( 1 << 5 ) );               // IO BANK
-    while ( GET32( RESETS_RESET_DONE ) & ( 1<< 5 ) == 0 );     // Reset Done?
+    while ( ( GET32( RESETS_RESET_DONE ) & ( 1 << 5 ) ) == 0 );     // Reset Done?
     PUT32( IO_BANK0_GPIO25_CTRL, 0x05 );                       // IO PAD = FUNC 5 (GPIO)
     PUT32( SIO_GPIO_OE, ( 1 << 25 ) );                         // GPIO_OE GPIO25
 
@@ -82,15 +84,19 @@ __attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
 
     // Reset PLL_SYS
     PUT32( ( RESETS_RESET | CLR ), ( 1 << 12 ) );                  // PLL_SYS
-    while ( GET32( RESETS_RESET_DONE ) & ( 1<< 12 ) == 0 );        // Reset Done?
+    while ( ( GET32( RESETS_RESET_DONE ) & ( 1 << 12 ) ) == 0 );        // Reset Done?
 
     // Set the PLL_SYS dividers and power up the VCO
-    PUT32( PLL_SYS_FBDIV, 0xFF);                                   // FBDIV = 255
+    // 12MHz / REFDIV 1 * FBDIV 125 = 1500MHz VCO (750 - 1600MHz) / POSTDIV1 6 / POSTDIV2 2 = 125MHz
+    PUT32( PLL_SYS_CS, 1 );                                        // REFDIV = 1
+    PUT32( PLL_SYS_FBDIV, 125 );                                   // FBDIV = 125
     PUT32( ( PLL_SYS_POW | CLR ), ( 1 << 5 ) | ( 1 << 0 ) );                   // PWR = VCO Power Down + PLL Power Down
-    while ( GET32( PLL_SYS_CS ) & ( 1 << 31 ) == 0 );               // VCO locked?
+    while ( ( GET32( PLL_SYS_CS ) & ( 1 << 31 ) ) == 0 );          // VCO locked?
 
+    PUT32( PLL_SYS_PRIM, ( 6 << 16 ) | ( 2 << 12 ) );              // POSTDIV1 = 6, POSTDIV2 = 2
     PUT32( ( PLL_SYS_POW | CLR ), ( 1 << 3 ) );                    // Power Up PLL Post Div
     PUT32 ( ( CLK_SYS_CTRL ), ( 1 << 0 ) );                        // CLK_SYS to use clk_sys_aux -> pll_sys
+    while ( GET32( CLK_SYS_SELECTED ) != ( 1 << 1 ) );             // wait for the glitchless mux
 
     // Blink for ever using PLL as source clock
     while( 1 )
@@ -68,13 +68,13 @@ static void resetSubsys()
 {
     // Reset IO Bank
     PUT32( ( RESETS_RESET | CLR ), ( 1 << 5 ) );
-    while( GET32( RESETS_RESET_DONE ) & ( 1 << 5 ) == 0 );
+    while( ( GET32( RESETS_RESET_DONE ) & ( 1 << 5 ) ) == 0 );
     // Reset PADS BANK
     PUT32( ( RESETS_RESET | CLR ), ( 1 << 8 ) );
-    while( GET32( RESETS_RESET_DONE ) & (1 << 8) == 0 );
+    while( ( GET32( RESETS_RESET_DONE ) & ( 1 << 8 ) ) == 0 );
     // Reset UART0
     PUT32( ( RESETS_RESET | CLR ), ( 1 << 22 ) );
-    while( GET32( RESETS_RESET_DONE ) & ( 1 << 22 ) == 0 );
+    while( ( GET32( RESETS_RESET_DONE ) & ( 1 << 22 ) ) == 0 );
 }
 
 /* configures UART0 to 9600 8N1*/
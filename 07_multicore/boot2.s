@@ -45,7 +45,7 @@ _copyToRam:
     ldr r0, =0x20000100;
     str r0, [r1]
 
-    ldr r0, =0x20002000
+    ldr r0, =__stack0_top__  ;@ Core0 stack on the top of SRAM4 (memmap_boot2.ld)
     mov sp, r0
 
     ;@ Jump to the main function
@@ -8,6 +8,9 @@
 #define SET (0x2000)
 #define CLR (0x3000)
 
+// Stack tops (memmap.ld)
+extern unsigned int __stack1_top__[];
+
 // Resets
 #define RESETS_BASE 0x4000C000UL
 #define RESETS_RESET (RESETS_BASE + 0x00)
@@ -112,13 +115,13 @@ static void resetSubsys()
 {
     // Reset IO Bank
     PUT32( ( RESETS_RESET | CLR ), ( 1 << 5 ) );
-    while( GET32( RESETS_RESET_DONE ) & ( 1 << 5 ) == 0 );
+    while( ( GET32( RESETS_RESET_DONE ) & ( 1 << 5 ) ) == 0 );
     // Reset PADS BANK
     PUT32( ( RESETS_RESET | CLR ), ( 1 << 8 ) );
-    while( GET32( RESETS_RESET_DONE ) & (1 << 8) == 0 );
+    while( ( GET32( RESETS_RESET_DONE ) & ( 1 << 8 ) ) == 0 );
     // Reset UART0
     PUT32( ( RESETS_RESET | CLR ), ( 1 << 22 ) );
-    while( GET32( RESETS_RESET_DONE ) & ( 1 << 22 ) == 0 );
+    while( ( GET32( RESETS_RESET_DONE ) & ( 1 << 22 ) ) == 0 );
 }
 
 /* configures UART0 to 9600 8N1*/
@@ -248,7 +251,7 @@ __attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
     PUT32( ( 0xd0000000 + 0x54 ), 0X20000100 );      // Vector Table
     GET32( (0xd0000000 + 0x58 ) );
     
-    PUT32( ( 0xd0000000 + 0x54 ), 0X20003000 );      // Core1 stack pointer
+    PUT32( ( 0xd0000000 + 0x54 ), (int)__stack1_top__ ); // Core1 stack pointer (SRAM5, see memmap.ld)
     GET32( (0xd0000000 + 0x58 ) );
 
     PUT32( ( 0xd0000000 + 0x54 ), (int)mainCore1 );  // Core1 main function
@@ -266,7 +269,7 @@ __attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
 
             delay( 5 * DELAY_100ms );
 
-            while( ( GET32( 0xd0000050 ) & ( 1 << 1 ) == 0 ) );  // Loop until FIFO is not full
+            while( ( GET32( 0xd0000050 ) & ( 1 << 1 ) ) == 0 );  // Loop until FIFO is not full
 
             PUT32( ( 0xd0000000 + 0x54 ), tmp );                 // write the counter value in the FIFO
         }
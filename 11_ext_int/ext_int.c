@@ -113,7 +113,8 @@ __attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
 
     while ( 1 )
     {
-        // loop here and wait for the tick interrupt
+        // sleep until the next interrupt (see 31_idle_manager for clock gating)
+        __asm volatile ( "wfi" );
     }
 
     return ( 0 );
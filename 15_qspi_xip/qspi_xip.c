@@ -0,0 +1,171 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+
+#define CLK_SYS_HZ        ( 12000000 )     // XOSC as clk_sys
+#define XIP_CACHED_BASE   ( 0x10000000 )   // XIP access through the cache
+#define XIP_NOCACHE_BASE  ( 0x13000000 )   // XIP access without cache: every read goes to the flash
+#define SRAM_BASE         ( 0x20000000 )
+#define TEST_SIZE         ( 16 * 1024 )    // bytes read on every measurement
+
+volatile uint32_t readChecksum;            // keeps the reads from being optimized out
+
+/* Setup XOSC and set it a source clock */
+static void setupClocks( void )
+{
+    // Enable the XOSC
+    XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+    XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+    XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+    while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+}
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+}
+
+/* configure LED */
+void ledConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+}
+
+/* 1 second delay */
+void delaySec( int sec )
+{
+    for (unsigned int x = 0; x < ( sec * 1000000 ); x++);
+}
+
+/* Unsigned division with the SIO hardware divider (the Cortex-M0+ has no divide instruction) */
+static uint32_t hwDivide( uint32_t dividend, uint32_t divisor )
+{
+    SIO->DIV_UDIVIDEND = dividend;
+    SIO->DIV_UDIVISOR  = divisor;
+    while ( SIO->DIV_CSR_b.READY == 0 );    // result is ready after 8 cycles
+    return ( SIO->DIV_QUOTIENT );
+}
+
+/* SysTick as a free running 24 bit down counter of clk_sys cycles */
+static void cycleCounterStart( void )
+{
+    PPB->SYST_RVR = 0x00FFFFFF;                      // max reload value
+    PPB->SYST_CVR = 0;                               // clear the current value
+    PPB->SYST_CSR = ( ( 1 << 2 ) | ( 1 << 0 ) );     // source clock = processor clock / enable (no interrupt)
+}
+
+/* Read TEST_SIZE bytes starting at baseAddr and return the clk_sys cycles it took */
+static uint32_t timedRead( uint32_t baseAddr )
+{
+    volatile uint32_t *pData = ( volatile uint32_t * ) baseAddr;
+    uint32_t checksum = 0;
+    uint32_t start;
+    uint32_t end;
+
+    start = PPB->SYST_CVR;
+    for ( uint32_t idx = 0; idx < ( TEST_SIZE / 4 ); idx++ )
+    {
+        checksum += pData[idx];
+    }
+    end = PPB->SYST_CVR;
+
+    readChecksum = checksum;
+    return ( ( start - end ) & 0x00FFFFFF );         // SysTick counts down
+}
+
+/* Flush the XIP cache so that the cached read starts cold */
+static void xipCacheFlush( void )
+{
+    XIP_CTRL->FLUSH = 1;
+    while ( XIP_CTRL->STAT_b.FLUSH_READY == 0 );
+}
+
+/* Print the bandwidth of a measurement in KB/s */
+static void printBandwidth( unsigned char *label, uint32_t cycles )
+{
+    uartTxStr( label );
+    uartPrintDec( cycles );
+    uartTxStr( " cycles -> " );
+    uartPrintDec( hwDivide( TEST_SIZE * ( CLK_SYS_HZ / 1000 ), cycles ) );   // bytes / ms = KB/s
+    uartTxStr( " KB/s\r\n" );
+}
+
+/* ***********************************************
+ * Main function
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    uint32_t cyclesSram;
+    uint32_t cyclesNoCache;
+    uint32_t cyclesCached;
+
+    // Setup clocks (XOSC as source clk)
+    setupClocks();
+    // Reset Subsystems (IO / PADS)
+    resetSubsys();
+    // Config UART0 (9600 8N1)
+    uartConfig();
+    // Config LED
+    ledConfig();
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "QSPI continuous read (0xEB) flash bandwidth\r\n\n" );
+
+    uartTxStr( "SSI CTRLR0:     " );
+    uartPrintDW( XIP_SSI->CTRLR0 );
+    uartTxStr( "SSI SPI_CTRLR0: " );
+    uartPrintDW( XIP_SSI->SPI_CTRLR0 );
+    uartTxStr( "SSI BAUDR:      " );
+    uartPrintDW( XIP_SSI->BAUDR );
+    uartTxStr( "Flash SCK (KHz): " );
+    uartPrintDec( hwDivide( CLK_SYS_HZ / 1000, XIP_SSI->BAUDR ) );
+    uartTxStr( "\r\n\n" );
+
+    cycleCounterStart();
+
+    // Same loop over SRAM: the cost of the loop itself
+    cyclesSram = timedRead( SRAM_BASE );
+
+    // Every word is a new QSPI transfer (address + mode bits + dummy + data)
+    cyclesNoCache = timedRead( XIP_NOCACHE_BASE );
+
+    // Cold cache: every 8 byte line is filled from the flash
+    xipCacheFlush();
+    cyclesCached = timedRead( XIP_CACHED_BASE );
+
+    uartTxStr( "Bytes read per test: " );
+    uartPrintDec( TEST_SIZE );
+    uartTxStr( "\r\n" );
+    printBandwidth( "SRAM (loop cost):     ", cyclesSram );
+    printBandwidth( "Flash, no cache:      ", cyclesNoCache );
+    printBandwidth( "Flash, cold cache:    ", cyclesCached );
+    uartTxStr( "Flash cycles per word (no cache, loop removed): " );
+    uartPrintDec( hwDivide( cyclesNoCache - cyclesSram, TEST_SIZE / 4 ) );
+    uartTxStr( "\r\n" );
+
+    while( true )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+        delaySec( 1 );
+    }
+
+    return ( 0 );
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+
+#define BOOT2_REPORT     ( ( volatile uint32_t * ) 0x20000000 )   // written by boot2: [0] copy cycles, [1] bytes copied
+#define OLD_COPY_SIZE    ( 0x1000 )                               // fixed size copied by the previous boot2.s
+
+/* Symbols exported by memmap.ld (the address of the symbol is its value) */
+extern char __image_load_addr__[];
+extern char __image_start__[];
+extern char __image_size__[];
+extern char __stack_top__[];
+
+/* Setup XOSC and set it a source clock */
+static void setupClocks( void )
+{
+    // Enable the XOSC
+    XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+    XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+    XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+    while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+}
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+}
+
+/* configure LED */
+void ledConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+}
+
+/* 1 second delay */
+void delaySec( int sec )
+{
+    for (unsigned int x = 0; x < ( sec * 1000000 ); x++);
+}
+
+/* Unsigned division with the SIO hardware divider (the Cortex-M0+ has no divide instruction) */
+static uint32_t hwDivide( uint32_t dividend, uint32_t divisor )
+{
+    SIO->DIV_UDIVIDEND = dividend;
+    SIO->DIV_UDIVISOR  = divisor;
+    while ( SIO->DIV_CSR_b.READY == 0 );    // result is ready after 8 cycles
+    return ( SIO->DIV_QUOTIENT );
+}
+
+/* ***********************************************
+ * Main function
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    // Read the boot2 report before anything else can overwrite it
+    uint32_t copyCycles = BOOT2_REPORT[0];
+    uint32_t copyBytes  = BOOT2_REPORT[1];
+
+    // Setup clocks (XOSC as source clk)
+    setupClocks();
+    // Reset Subsystems (IO / PADS)
+    resetSubsys();
+    // Config UART0 (9600 8N1)
+    uartConfig();
+    // Config LED
+    ledConfig();
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "boot2 copies exactly the size of the image\r\n\n" );
+
+    uartTxStr( "Image load address (FLASH): " );
+    uartPrintDW( ( uint32_t ) __image_load_addr__ );
+    uartTxStr( "Image address (SRAM):       " );
+    uartPrintDW( ( uint32_t ) __image_start__ );
+    uartTxStr( "Stack top:                  " );
+    uartPrintDW( ( uint32_t ) __stack_top__ );
+    uartTxStr( "Image size (linker):        " );
+    uartPrintDec( ( uint32_t ) __image_size__ );
+    uartTxStr( " bytes\r\n" );
+    uartTxStr( "Bytes copied by boot2:      " );
+    uartPrintDec( copyBytes );
+    uartTxStr( " bytes\r\n" );
+    uartTxStr( "Copy time (ROSC cycles):    " );
+    uartPrintDec( copyCycles );
+    uartTxStr( "\r\n" );
+    uartTxStr( "Cycles per 32 bytes:        " );
+    uartPrintDec( hwDivide( copyCycles, copyBytes / 32 ) );
+    uartTxStr( "\r\n" );
+    uartTxStr( "Fixed 0x1000 copy (estim.): " );
+    uartPrintDec( hwDivide( copyCycles, copyBytes / 32 ) * ( OLD_COPY_SIZE / 32 ) );
+    uartTxStr( " cycles\r\n" );
+
+    while( true )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+        delaySec( 1 );
+    }
+
+    return ( 0 );
+}
@@ -0,0 +1,264 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+
+#define GPIO_BUILT_IN_LED    ( 25 )
+#define IO_IRQ_BANK0         ( 13 )
+#define UART0_IRQ            ( 20 )
+#define COUNT_250MS          ( 12000000 / 4 )   // with XOSC (12MHZ), 12,000,000 ticks = 1 second.
+#define TEST_WORDS           ( 1024 )
+
+/* Functions tagged with __time_critical are copied to SRAM at startup */
+#define __time_critical      __attribute__( ( section( ".time_critical" ) ) )
+
+/* Symbols exported by memmap.ld */
+extern uint32_t __time_critical_load__[];
+extern uint32_t __time_critical_start__[];
+extern uint32_t __time_critical_end__[];
+extern uint32_t __data_load__[];
+extern uint32_t __data_start__[];
+extern uint32_t __data_end__[];
+
+volatile uint32_t tickCount;
+volatile uint32_t buttonCount;
+volatile uint32_t testChecksum;
+
+/* function declaration */
+void irqSysTick( void );
+void irqiobank0( void );
+void irqUart0( void );
+
+/* Vector Table (Linker script has been upodated) */
+__attribute__( ( used, section( ".vectors" ) ) ) void ( *vectors[] )( void ) =
+{
+    0,          //  0 stack pointer value (NA)
+    0,          //  1 reset (NA)
+    0,          //  2 NMI
+    0,          //  3 hardFault
+    0,          //  4 reserved
+    0,          //  5 reserved
+    0,          //  6 reserved
+    0,          //  7 reserved
+    0,          //  8 reserved
+    0,          //  9 reserved
+    0,          // 10 reserved
+    0,          // 11 SVCall
+    0,          // 12 reserved
+    0,          // 13 reserved
+    0,          // 14 pendSV
+    irqSysTick, // 15 sysTick
+    0,          // 00 external Int
+    0,          // 01 external Int
+    0,          // 02 external Int
+    0,          // 03 external Int
+    0,          // 04 external Int
+    0,          // 05 external Int
+    0,          // 06 external Int
+    0,          // 07 external Int
+    0,          // 08 external Int
+    0,          // 09 external Int
+    0,          // 10 external Int
+    0,          // 11 external Int
+    0,          // 12 external Int
+    irqiobank0, // 13 external Int (IO BANK0)
+    0,          // 14 external Int
+    0,          // 15 external Int
+    0,          // 16 external Int
+    0,          // 17 external Int
+    0,          // 18 external Int
+    0,          // 19 external Int
+    irqUart0,   // 20 external Int (UART0)
+};
+
+/* Handler of the Tick interrupt (runs from SRAM) */
+__time_critical void irqSysTick( void )
+{
+    tickCount++;
+    SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << GPIO_BUILT_IN_LED );   // XOR the LED pin
+}
+
+/* Handler of the GPIO15 edge-low interrupt (runs from SRAM) */
+__time_critical void irqiobank0( void )
+{
+    if ( IO_BANK0->INTR1_b.GPIO15_EDGE_LOW == 1 )                    // check the raw interrupt of GPIO15 edge low
+    {
+        IO_BANK0->INTR1_b.GPIO15_EDGE_LOW = 1;                       // Clear by writing raw interrupt
+        buttonCount++;
+    }
+}
+
+/* Handler of the UART0 RX interrupt: echo the received data (runs from SRAM) */
+__time_critical void irqUart0( void )
+{
+    while ( UART0->UARTFR_b.RXFE == 0 )                              // until the RX FIFO is empty
+    {
+        UART0->UARTDR_b.DATA = UART0->UARTDR_b.DATA;                 // TX the RX data
+    }
+}
+
+/* Test load executed from the flash (XIP) */
+uint32_t checksumFlash( uint32_t *pData, uint32_t words )
+{
+    uint32_t checksum = 0;
+    for ( uint32_t idx = 0; idx < words; idx++ )
+    {
+        checksum = ( checksum << 1 ) ^ pData[idx];
+    }
+    return ( checksum );
+}
+
+/* Same test load, executed from SRAM */
+__time_critical uint32_t checksumSram( uint32_t *pData, uint32_t words )
+{
+    uint32_t checksum = 0;
+    for ( uint32_t idx = 0; idx < words; idx++ )
+    {
+        checksum = ( checksum << 1 ) ^ pData[idx];
+    }
+    return ( checksum );
+}
+
+/* Copy a section from its load address (FLASH) to its run address (SRAM) */
+static void copySection( uint32_t *pLoad, uint32_t *pStart, uint32_t *pEnd )
+{
+    while ( pStart < pEnd )
+    {
+        *pStart++ = *pLoad++;
+    }
+}
+
+/* Setup XOSC and set it a source clock */
+static void setupClocks( void )
+{
+    // Enable the XOSC
+    XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+    XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+    XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+    while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+}
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+}
+
+/* configure LED and button (GPIO15) */
+void gpioConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << GPIO_BUILT_IN_LED );
+
+    IO_BANK0->GPIO15_CTRL_b.FUNCSEL = 5;                                     // Set GPIO15 as SIO (F5)
+    PADS_BANK0->GPIO15 = ( ( 1 << PADS_BANK0_GPIO15_OD_Pos ) |               //  Output disabled
+                           ( 1 << PADS_BANK0_GPIO15_IE_Pos ) |               //  Input enabled
+                           ( 1 << PADS_BANK0_GPIO15_PUE_Pos )|               //  Pull up
+                           ( 1 << PADS_BANK0_GPIO15_SCHMITT_Pos ) );         //  Schmitt trigger
+    IO_BANK0->INTR1_b.GPIO15_EDGE_LOW = 1;                                   // write to clear raw interrupt: edge-low
+    IO_BANK0->PROC0_INTE1_b.GPIO15_EDGE_LOW = 1;                             // interrupt enabled: edge-low
+}
+
+/* Measure a function with the SysTick (clk_sys cycles) */
+static uint32_t measureCycles( uint32_t ( *function )( uint32_t *pData, uint32_t words ) )
+{
+    uint32_t start;
+
+    PPB->SYST_RVR = 0x00FFFFFF;                      // max reload value
+    PPB->SYST_CVR = 0;                               // clear the current value
+    PPB->SYST_CSR = ( ( 1 << 2 ) | ( 1 << 0 ) );     // source clock = processor clock / enable (no interrupt)
+    start = PPB->SYST_CVR;
+    testChecksum = function( __data_start__, TEST_WORDS );
+    return ( ( start - PPB->SYST_CVR ) & 0x00FFFFFF );
+}
+
+/* 1 second delay */
+void delaySec( int sec )
+{
+    for (unsigned int x = 0; x < ( sec * 1000000 ); x++);
+}
+
+/* ***********************************************
+ * Main function (runs from the flash)
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    // Copy the time critical functions and the initialized data to SRAM
+    copySection( __time_critical_load__, __time_critical_start__, __time_critical_end__ );
+    copySection( __data_load__, __data_start__, __data_end__ );
+    tickCount   = 0;
+    buttonCount = 0;
+
+    // Setup clocks (XOSC as source clk)
+    setupClocks();
+    // Reset Subsystems (IO / PADS)
+    resetSubsys();
+    // Config UART0 (9600 8N1)
+    uartConfig();
+    // Config LED and button
+    gpioConfig();
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "XIP code with time critical functions in SRAM\r\n\n" );
+
+    uartTxStr( "main()          " );
+    uartPrintDW( ( uint32_t ) main );
+    uartTxStr( "irqSysTick()    " );
+    uartPrintDW( ( uint32_t ) irqSysTick );
+    uartTxStr( "irqiobank0()    " );
+    uartPrintDW( ( uint32_t ) irqiobank0 );
+    uartTxStr( "irqUart0()      " );
+    uartPrintDW( ( uint32_t ) irqUart0 );
+    uartTxStr( ".time_critical size: " );
+    uartPrintDec( ( uint32_t ) __time_critical_end__ - ( uint32_t ) __time_critical_start__ );
+    uartTxStr( " bytes\r\n\n" );
+
+    // Same function from XIP (cold and warm cache) and from SRAM
+    XIP_CTRL->FLUSH = 1;
+    while ( XIP_CTRL->STAT_b.FLUSH_READY == 0 );
+    uartTxStr( "checksum from flash (cold cache): " );
+    uartPrintDec( measureCycles( checksumFlash ) );
+    uartTxStr( " cycles\r\n" );
+    uartTxStr( "checksum from flash (warm cache): " );
+    uartPrintDec( measureCycles( checksumFlash ) );
+    uartTxStr( " cycles\r\n" );
+    uartTxStr( "checksum from SRAM:               " );
+    uartPrintDec( measureCycles( checksumSram ) );
+    uartTxStr( " cycles\r\n\n" );
+
+    // Enable the interrupts: the handlers are already in SRAM
+    UART0->UARTIMSC = ( ( 1 << UART0_UARTIMSC_RTIM_Pos ) |                  // RX Timeout Interrupt
+                        ( 1 << UART0_UARTIMSC_RXIM_Pos ) );                 // RX interrupt
+    PPB->NVIC_ICPR = ( ( 1 << IO_IRQ_BANK0 ) | ( 1 << UART0_IRQ ) );        // Interrupt Clear-Pending
+    PPB->NVIC_ISER = ( ( 1 << IO_IRQ_BANK0 ) | ( 1 << UART0_IRQ ) );        // Interrupt Set-Enable
+    PPB->SYST_RVR = COUNT_250MS - 1;
+    PPB->SYST_CVR = 0;
+    PPB->SYST_CSR = ( ( 1 << 2 ) | ( 1 << 1 ) | ( 1 << 0 ) );             // processor clock / tick int / enable
+
+    while ( true )
+    {
+        delaySec( 1 );
+        uartTxStr( "ticks: " );
+        uartPrintDec( tickCount );
+        uartTxStr( "  button: " );
+        uartPrintDec( buttonCount );
+        uartTxStr( "\r\n" );
+    }
+
+    return ( 0 );
+}
@@ -0,0 +1,169 @@
+;@ Copyright (c) 2024 CarlosFTM
+;@ This code is licensed under MIT license (see LICENSE.txt for details)
+
+;@ Flash second stage for the W25Q flash of the Pico board.
+;@ Instead of the plain serial read (cmd 0x03), the flash is set to the
+;@ Quad-SPI "Fast Read Quad I/O" (cmd 0xEB) in continuous read mode:
+;@ after the first command only the address + mode bits are sent, over 4 data lines.
+;@ The code runs from the flash, so a fast XIP matters on every instruction fetch.
+
+.cpu cortex-m0plus
+.thumb
+.syntax unified
+
+.ifndef FLASH_CLKDIV
+.set FLASH_CLKDIV,         4
+.endif
+
+.set XIP_SSI_BASE,         0x18000000
+.set CTRLR0,               0x00
+.set CTRLR1,               0x04
+.set SSIENR,               0x08
+.set BAUDR,                0x14
+.set SR,                   0x28
+.set DR0,                  0x60
+.set RX_SAMPLE_DLY,        0xF0
+.set SPI_CTRLR0,           0xF4
+.set SR_BUSY,              0x01
+.set SR_TFE,               0x04
+
+.set PADS_QSPI_BASE,       0x40020000
+.set PADS_QSPI_SCLK,       0x04
+.set PADS_SCLK_8MA_FAST,   0x21
+
+.set CMD_WRITE_ENABLE,     0x06
+.set CMD_WRITE_STATUS,     0x01
+.set CMD_READ_STATUS,      0x05
+.set CMD_READ_STATUS2,     0x35
+.set CMD_READ_QUAD_IO,     0xEB
+.set SREG2_QE,             0x02
+.set MODE_CONTINUOUS_READ, 0xA0
+
+.set CTRLR0_XIP,           0x005F0300  ;@ SPI_FRF = quad, DFS_32 = 31, TMOD = EEPROM read
+.set SPI_CTRLR0_ENTER_XIP, 0x00002221  ;@ WAIT = 4, INST_L = 8 bit, ADDR_L = 32 bit, 1C2A
+.set SPI_CTRLR0_XIP,       0xA0002022  ;@ XIP_CMD = 0xA0, WAIT = 4, INST_L = none, ADDR_L = 32 bit, 2C2A
+
+.set VTOR,                 0xE000ED08
+
+.section .boot2, "ax"
+    ldr r3, =XIP_SSI_BASE
+
+    ;@ Disable SSI to allow its configuration
+    movs r1, #0
+    str r1, [r3, #SSIENR]
+
+    ;@ SCLK pad: 8mA drive and fast slew rate
+    ldr r0, =PADS_QSPI_BASE
+    movs r1, #PADS_SCLK_8MA_FAST
+    str r1, [r0, #PADS_QSPI_SCLK]
+
+    ;@ SSI clock divider (set by FLASH_CLKDIV on the Makefile)
+    movs r1, #FLASH_CLKDIV
+    str r1, [r3, #BAUDR]
+
+    ;@ Sample the RX data 1 clk_sys later (needed by the small dividers)
+    movs r1, #1
+    movs r2, #RX_SAMPLE_DLY
+    str r1, [r3, r2]
+
+    ;@ Standard SPI with 8 bit frames, to talk to the flash status registers
+    movs r1, #7
+    lsls r1, r1, #16
+    str r1, [r3, #CTRLR0]
+    movs r1, #1
+    str r1, [r3, #SSIENR]
+
+    ;@ Quad mode must be enabled on the flash: QE bit of status register 2
+    movs r0, #CMD_READ_STATUS2
+    bl _readFlashSreg
+    cmp r0, #SREG2_QE
+    beq _qeIsSet
+
+    movs r1, #CMD_WRITE_ENABLE
+    str r1, [r3, #DR0]
+    bl _waitSsiReady
+    ldr r1, [r3, #DR0]
+
+    movs r1, #CMD_WRITE_STATUS
+    str r1, [r3, #DR0]
+    movs r0, #0
+    str r0, [r3, #DR0]         ;@ status register 1 = 0x00
+    movs r1, #SREG2_QE
+    str r1, [r3, #DR0]         ;@ status register 2 = QE
+    bl _waitSsiReady
+    ldr r1, [r3, #DR0]
+    ldr r1, [r3, #DR0]
+    ldr r1, [r3, #DR0]
+
+_waitFlashBusy:
+    movs r0, #CMD_READ_STATUS
+    bl _readFlashSreg
+    movs r1, #1
+    tst r0, r1
+    bne _waitFlashBusy
+
+_qeIsSet:
+    movs r1, #0
+    str r1, [r3, #SSIENR]
+    str r1, [r3, #CTRLR1]      ;@ 1 data frame per transfer
+
+    ;@ Quad SPI, 32 clocks per data frame, EEPROM read mode
+    ldr r1, =CTRLR0_XIP
+    str r1, [r3, #CTRLR0]
+
+    ;@ 8 bit command (serial) + 24 bit address & 8 mode bits (quad) + 4 dummy clocks
+    ldr r1, =SPI_CTRLR0_ENTER_XIP
+    movs r2, #SPI_CTRLR0
+    str r1, [r3, r2]
+    movs r1, #1
+    str r1, [r3, #SSIENR]
+
+    ;@ Send the 0xEB command with address 0 and mode bits 0xA0 (continuous read)
+    movs r1, #CMD_READ_QUAD_IO
+    str r1, [r3, #DR0]
+    movs r1, #MODE_CONTINUOUS_READ
+    str r1, [r3, #DR0]
+    bl _waitSsiReady
+
+    ;@ From now on the command is not sent anymore, only address + mode bits
+    movs r1, #0
+    str r1, [r3, #SSIENR]
+    ldr r1, =SPI_CTRLR0_XIP
+    movs r2, #SPI_CTRLR0
+    str r1, [r3, r2]
+    movs r1, #1
+    str r1, [r3, #SSIENR]
+
+    ;@ No copy to SRAM: the code is executed in place (XIP) from the flash.
+    ;@ The C runtime startup (crt0.s) sets the stacks and initializes the SRAM.
+    ldr r1, =VTOR
+    ldr r0, =0x10000100
+    str r0, [r1]
+
+    ldr r0, =0x10000201
+    bx  r0
+
+;@ Wait until the TX FIFO is empty and the SSI is not busy
+_waitSsiReady:
+    push {r0, r1, lr}
+_waitSsiLoop:
+    ldr r1, [r3, #SR]
+    movs r0, #SR_TFE
+    tst r1, r0
+    beq _waitSsiLoop
+    movs r0, #SR_BUSY
+    tst r1, r0
+    bne _waitSsiLoop
+    pop {r0, r1, pc}
+
+;@ Send the command in r0 and return the status register value in r0
+_readFlashSreg:
+    push {r1, lr}
+    str r0, [r3, #DR0]
+    str r0, [r3, #DR0]         ;@ dummy byte to clock the register out
+    bl _waitSsiReady
+    ldr r0, [r3, #DR0]
+    ldr r0, [r3, #DR0]
+    pop {r1, pc}
+
+.end
@@ -0,0 +1,84 @@
+;@ Copyright (c) 2024 CarlosFTM
+;@ This code is licensed under MIT license (see LICENSE.txt for details)
+
+;@ C runtime startup. boot2 jumps here (0x10000200) before main():
+;@   1. set the core0 stack pointer
+;@   2. copy .data from the flash to SRAM (16 bytes per ldmia/stmia)
+;@   3. zero .bss (16 bytes per stmia)
+;@   4. call the constructors listed on .init_array
+;@   5. save its own cost in clk_sys cycles (crt0Cycles) and call main()
+
+.cpu cortex-m0plus
+.thumb
+.syntax unified
+
+.set SYST_CSR,           0xE000E010
+.set SYST_RVR,           0x04          ;@ offset from SYST_CSR
+.set SYST_CVR,           0x08          ;@ offset from SYST_CSR
+
+.section .boot.entry, "ax"
+.global _reset
+.thumb_func
+_reset:
+    ;@ SysTick counts the clk_sys cycles spent on the startup
+    ldr r7, =SYST_CSR
+    ldr r0, =0x00FFFFFF
+    str r0, [r7, #SYST_RVR]
+    str r0, [r7, #SYST_CVR]
+    movs r0, #5                 ;@ processor clock + enable
+    str r0, [r7]
+
+    ldr r0, =__stack0_top__
+    mov sp, r0
+
+    ;@ Copy .data (start, end and load address are 16 bytes aligned)
+    ldr r4, =__data_load__
+    ldr r5, =__data_start__
+    ldr r6, =__data_end__
+    b _copyDataCheck
+_copyData:
+    ldmia r4!, {r0-r3}
+    stmia r5!, {r0-r3}
+_copyDataCheck:
+    cmp r5, r6
+    blo _copyData
+
+    ;@ Zero .bss (start and end are 16 bytes aligned)
+    movs r0, #0
+    movs r1, #0
+    movs r2, #0
+    movs r3, #0
+    ldr r5, =__bss_start__
+    ldr r6, =__bss_end__
+    b _zeroBssCheck
+_zeroBss:
+    stmia r5!, {r0-r3}
+_zeroBssCheck:
+    cmp r5, r6
+    blo _zeroBss
+
+    ;@ Call the constructors (r4-r7 are preserved by the called functions)
+    ldr r4, =__init_array_start__
+    ldr r5, =__init_array_end__
+    b _initArrayCheck
+_initArray:
+    ldmia r4!, {r0}
+    blx r0
+_initArrayCheck:
+    cmp r4, r5
+    blo _initArray
+
+    ;@ Save the startup cost (after .bss has been cleared)
+    ldr r0, [r7, #SYST_CVR]
+    ldr r1, =0x00FFFFFF
+    subs r1, r1, r0
+    ldr r0, =crt0Cycles
+    str r1, [r0]
+    movs r0, #0
+    str r0, [r7]                ;@ stop SysTick
+
+    bl main
+_exit:
+    b _exit
+
+.end
@@ -0,0 +1,204 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+
+/* Symbols exported by memmap.ld */
+extern uint32_t __data_start__[];
+extern uint32_t __data_end__[];
+extern uint32_t __bss_start__[];
+extern uint32_t __bss_end__[];
+extern uint32_t __stack0_top__[];
+extern uint32_t __stack1_top__[];
+
+/* Written by crt0.s */
+uint32_t crt0Cycles;
+
+/* Test data: .data must be copied, .bss must be zero, the constructor must run */
+uint32_t dataTable[4] = { 0x11111111, 0x22222222, 0x33333333, 0x44444444 };
+uint32_t bssTable[64];
+uint32_t constructorValue;
+
+/* Handles hardfault interrupt */
+void hardFault( void )
+{
+    while ( 1 );
+}
+
+/* Vector Table (Linker script has been upodated) */
+__attribute__( ( used, section( ".vectors" ) ) ) void ( *vectors[] )( void ) =
+{
+    0,          //  0 stack pointer value (NA)
+    0,          //  1 reset (NA)
+    0,          //  2 NMI
+    hardFault,  //  3 hardFault
+};
+
+/* Called by crt0.s before main() */
+__attribute__( ( constructor ) ) void constructorTest( void )
+{
+    constructorValue = 0xC0FFEE;
+}
+
+/* Setup XOSC and set it a source clock */
+static void setupClocks( void )
+{
+    // Enable the XOSC
+    XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+    XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+    XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+    while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+}
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+}
+
+/* configure LED */
+void ledConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+}
+
+/* 1 second delay */
+void delaySec( int sec )
+{
+    for (unsigned int x = 0; x < ( sec * 1000000 ); x++);
+}
+
+/* Read the stack pointer of the running core */
+static uint32_t readSp( void )
+{
+    uint32_t sp;
+    __asm volatile ( "mov %0, sp" : "=r" ( sp ) );
+    return ( sp );
+}
+
+/* Core1: report its stack pointer to core0 and wait */
+void mainCore1( void )
+{
+    while ( SIO->FIFO_ST_b.RDY == 0 );
+    SIO->FIFO_WR = readSp();
+    while ( 1 )
+    {
+        __asm volatile ( "wfe" );
+    }
+}
+
+/* Start core1 with its own stack (__stack1_top__), using the bootrom FIFO handshake */
+static void launchCore1( void ( *entry )( void ) )
+{
+    uint32_t cmd[6];
+    uint32_t idx = 0;
+
+    cmd[0] = 0;
+    cmd[1] = 0;
+    cmd[2] = 1;
+    cmd[3] = ( uint32_t ) vectors;          // Vector table
+    cmd[4] = ( uint32_t ) __stack1_top__;   // Core1 stack pointer
+    cmd[5] = ( uint32_t ) entry;            // Core1 main function
+
+    while ( idx < 6 )
+    {
+        if ( cmd[idx] == 0 )
+        {
+            while ( SIO->FIFO_ST_b.VLD == 1 )  // empty the RX FIFO before a 0 command
+            {
+                ( void ) SIO->FIFO_RD;
+            }
+            __asm volatile ( "sev" );
+        }
+        while ( SIO->FIFO_ST_b.RDY == 0 );
+        SIO->FIFO_WR = cmd[idx];
+        __asm volatile ( "sev" );
+        while ( SIO->FIFO_ST_b.VLD == 0 );
+        if ( SIO->FIFO_RD == cmd[idx] )     // core1 echoes every command back
+        {
+            idx++;
+        }
+        else
+        {
+            idx = 0;                        // wrong answer: start again
+        }
+    }
+}
+
+/* ***********************************************
+ * Main function (called by crt0.s)
+ * ********************************************* */
+int main( void )
+{
+    bool bssIsZero = true;
+
+    // Setup clocks (XOSC as source clk)
+    setupClocks();
+    // Reset Subsystems (IO / PADS)
+    resetSubsys();
+    // Config UART0 (9600 8N1)
+    uartConfig();
+    // Config LED
+    ledConfig();
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "C runtime startup (crt0.s)\r\n\n" );
+
+    uartTxStr( "Startup cost (ROSC cycles): " );
+    uartPrintDec( crt0Cycles );
+    uartTxStr( "\r\n.data bytes copied:         " );
+    uartPrintDec( ( uint32_t ) __data_end__ - ( uint32_t ) __data_start__ );
+    uartTxStr( "\r\n.bss bytes cleared:         " );
+    uartPrintDec( ( uint32_t ) __bss_end__ - ( uint32_t ) __bss_start__ );
+    uartTxStr( "\r\n\n" );
+
+    uartTxStr( "dataTable[3] (expected 0x44444444): " );
+    uartPrintDW( dataTable[3] );
+
+    for ( int idx = 0; idx < 64; idx++ )
+    {
+        if ( bssTable[idx] != 0 )
+        {
+            bssIsZero = false;
+        }
+    }
+    uartTxStr( bssIsZero ? "bssTable is zero\r\n" : "bssTable is NOT zero\r\n" );
+
+    uartTxStr( "constructorValue (expected 0x00c0ffee): " );
+    uartPrintDW( constructorValue );
+
+    uartTxStr( "\r\nCore0 stack: " );
+    uartPrintDW( readSp() );
+    launchCore1( mainCore1 );
+    while ( SIO->FIFO_ST_b.VLD == 0 );
+    uartTxStr( "Core1 stack: " );
+    uartPrintDW( SIO->FIFO_RD );
+    uartTxStr( "Stack tops:  " );
+    uartPrintDW( ( uint32_t ) __stack0_top__ );
+    uartTxStr( "             " );
+    uartPrintDW( ( uint32_t ) __stack1_top__ );
+
+    while( true )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+        delaySec( 1 );
+    }
+
+    return ( 0 );
+}
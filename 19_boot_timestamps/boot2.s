@@ -0,0 +1,111 @@
+;@ Copyright (c) 2024 CarlosFTM
+;@ This code is licensed under MIT license (see LICENSE.txt for details)
+
+;@ Flash second stage with boot log: the TIMER is started before the copy,
+;@ and the copy is timestamped in the boot log (see bootlog.h).
+
+.cpu cortex-m0plus
+.thumb
+.syntax unified
+
+.set XIP_SSI_BASE,       0x18000000
+.set CTRLR0,             0x00
+.set CTRLR1,             0x04
+.set SSIENR,             0x08
+.set BAUDR,              0x14
+.set SPI_CTRLR0,         0xF4
+.set VTOR,               0xE000ED08
+
+.set RESETS_RESET_CLR,   0x4000C000 + 0x3000
+.set RESETS_RESET_DONE,  0x4000C008
+.set RESETS_TIMER,       (1 << 21)
+.set WATCHDOG_TICK,      0x4005802C
+.set TICK_ENABLE,        (1 << 9)
+.set ROSC_MHZ,           6             ;@ clk_ref is the ring oscillator (~6MHz) at this point
+.set TIMER_TIMERAWL,     0x40054028
+
+.set BOOTLOG,            0x20000000    ;@ boot2 area in SRAM, free after boot (must match bootlog.h)
+.set BOOTLOG_MAGIC,      0xB0071065
+.set PHASE_BOOT2_COPY,   0             ;@ must match the phases of bootlog.h
+.set PHASE_BOOT2_DONE,   1
+
+.set FLASH_IMAGE,        0x10000100    ;@ the image starts after the 256 bytes of boot2
+.set SRAM_IMAGE,         0x20000100
+.set IMAGE_HEADER,       0xF0          ;@ offset of the image header (size and stack top) written by memmap.ld
+
+.section .boot2, "ax"
+    ;@ Release the TIMER reset and start the 1us tick (from clk_ref)
+    ldr r0, =RESETS_RESET_CLR
+    ldr r1, =RESETS_TIMER
+    str r1, [r0]
+    ldr r0, =RESETS_RESET_DONE
+_waitTimerReset:
+    ldr r2, [r0]
+    tst r2, r1
+    beq _waitTimerReset
+    ldr r0, =WATCHDOG_TICK
+    ldr r1, =(TICK_ENABLE | ROSC_MHZ)
+    str r1, [r0]
+
+    ;@ Serial flash read (cmd 0x03), same configuration as the other examples
+    ldr r3, =XIP_SSI_BASE
+    movs r1, #0
+    str r1, [r3, #SSIENR]
+    ldr r1, =0x001F0300
+    str r1, [r3, #CTRLR0]
+    movs r1, #8
+    str r1, [r3, #BAUDR]
+    ldr r1, =0x03000218
+    movs r2, #SPI_CTRLR0
+    str r1, [r3, r2]
+    movs r1, #0
+    str r1, [r3, #CTRLR1]
+    movs r1, #1
+    str r1, [r3, #SSIENR]
+
+    ;@ Boot log: header (magic + 2 records) and the first record
+    ldr r7, =BOOTLOG
+    ldr r0, =BOOTLOG_MAGIC
+    str r0, [r7]
+    movs r0, #2
+    str r0, [r7, #4]
+    movs r0, #PHASE_BOOT2_COPY
+    str r0, [r7, #8]
+    ldr r3, =TIMER_TIMERAWL
+    ldr r0, [r3]
+    str r0, [r7, #12]
+
+    ldr r4, =FLASH_IMAGE ;@ Source address (FLASH)
+    ldr r5, =SRAM_IMAGE  ;@ Destination (SRAM)
+    movs r0, #IMAGE_HEADER
+    ldr r6, [r4, r0]     ;@ Size of code (multiple of 32 bytes)
+
+_copyToRam:
+    ;@ load 32 bytes from FLASH to RAM at a time
+    ldmia r4!, {r0-r3}
+    stmia r5!, {r0-r3}
+    ldmia r4!, {r0-r3}
+    stmia r5!, {r0-r3}
+    subs  r6, #32
+    bhi   _copyToRam
+
+    ;@ Boot log: second record
+    movs r0, #PHASE_BOOT2_DONE
+    str r0, [r7, #16]
+    ldr r3, =TIMER_TIMERAWL
+    ldr r0, [r3]
+    str r0, [r7, #20]
+
+    ;@ Jump to the main function
+    ldr r1, =VTOR
+    ldr r0, =SRAM_IMAGE
+    str r0, [r1]
+
+    ldr r2, =(SRAM_IMAGE + IMAGE_HEADER)
+    ldr r0, [r2, #4]     ;@ stack top from the image header
+    mov sp, r0
+
+    ldr r0, =0x20000201
+    bx  r0
+
+.end
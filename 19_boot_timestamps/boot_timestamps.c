@@ -0,0 +1,111 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+#include "bootlog.h"
+
+/* Setup XOSC and set it a source clock */
+static void setupClocks( void )
+{
+    // Enable the XOSC
+    bootlogMark( BOOTLOG_XOSC_START );
+    XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+    XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+    XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+    while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+    bootlogSetTick( 12 );                   // clk_ref = 12MHz from now on
+    bootlogMark( BOOTLOG_XOSC_STABLE );
+}
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    bootlogMark( BOOTLOG_RESET_START );
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+    bootlogMark( BOOTLOG_RESET_DONE );
+}
+
+/* PLL_SYS at 125MHz ( 12MHz / 1 * 125 = 1500MHz VCO / 6 / 2 ) as clk_sys */
+static void setupPll( void )
+{
+    bootlogMark( BOOTLOG_PLL_START );
+    RESETS_CLR->RESET = ( 1 << RESETS_RESET_pll_sys_Pos );
+    while ( RESETS->RESET_DONE_b.pll_sys == 0 );
+
+    PLL_SYS->CS        = ( 1 << PLL_SYS_CS_REFDIV_Pos );                    // REFDIV = 1
+    PLL_SYS->FBDIV_INT = 125;                                               // VCO = 12MHz * 125 = 1500MHz
+    PLL_SYS_CLR->PWR   = ( ( 1 << PLL_SYS_PWR_PD_Pos ) |                    // Power up the PLL and the VCO
+                           ( 1 << PLL_SYS_PWR_VCOPD_Pos ) );
+    while ( PLL_SYS->CS_b.LOCK == 0 );                                      // VCO locked?
+
+    PLL_SYS->PRIM    = ( ( 6 << PLL_SYS_PRIM_POSTDIV1_Pos ) |               // 1500MHz / 6 / 2 = 125MHz
+                         ( 2 << PLL_SYS_PRIM_POSTDIV2_Pos ) );
+    PLL_SYS_CLR->PWR = ( 1 << PLL_SYS_PWR_POSTDIVPD_Pos );                  // Power up the post dividers
+
+    CLOCKS->CLK_SYS_CTRL_b.AUXSRC = 0;                                      // CLK SYS AUX = pll_sys
+    CLOCKS->CLK_SYS_CTRL_b.SRC    = 1;                                      // CLK SYS source = clk_sys_aux
+    while ( CLOCKS->CLK_SYS_SELECTED != ( 1 << 1 ) );                       // wait for the glitchless mux
+    bootlogMark( BOOTLOG_PLL_LOCKED );
+}
+
+/* configure LED */
+void ledConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+}
+
+/* 1 second delay (at 125MHz) */
+void delaySec( int sec )
+{
+    for (unsigned int x = 0; x < ( sec * 10000000 ); x++);
+}
+
+/* ***********************************************
+ * Main function
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    // Keep the records written by boot2
+    bootlogInit();
+    bootlogMark( BOOTLOG_MAIN );
+
+    // Setup clocks (XOSC as source clk)
+    setupClocks();
+    // Reset Subsystems (IO / PADS)
+    resetSubsys();
+    // PLL as clk_sys (clk_peri stays on the XOSC)
+    setupPll();
+    // Config UART0 (9600 8N1)
+    uartConfig();
+    bootlogMark( BOOTLOG_UART_READY );
+    // Config LED
+    ledConfig();
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "Boot phase timestamps\r\n\n" );
+    bootlogPrint();
+
+    while( true )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+        delaySec( 1 );
+    }
+
+    return ( 0 );
+}
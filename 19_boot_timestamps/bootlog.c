@@ -0,0 +1,83 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include "bootlog.h"
+#include "uart.h"
+
+#define ROSC_MHZ    ( 6 )     // clk_ref after boot is the ring oscillator (~6MHz)
+
+static bootlog_t * const pBootlog = ( bootlog_t * ) BOOTLOG_ADDR;
+
+static const char * const phaseName[BOOTLOG_USER] =
+{
+    "boot2 copy start ",
+    "boot2 copy done  ",
+    "main()           ",
+    "XOSC start       ",
+    "XOSC stable      ",
+    "reset start      ",
+    "reset done       ",
+    "PLL start        ",
+    "PLL locked       ",
+    "UART ready       ",
+};
+
+/* Starts the TIMER and an empty log, unless boot2.s already did it */
+void bootlogInit( void )
+{
+    if ( ( RESETS->RESET_DONE_b.timer == 0 ) || ( pBootlog->magic != BOOTLOG_MAGIC ) )
+    {
+        RESETS_CLR->RESET = ( 1 << RESETS_RESET_timer_Pos );
+        while ( RESETS->RESET_DONE_b.timer == 0 );
+        WATCHDOG->TICK = ( ( 1 << WATCHDOG_TICK_ENABLE_Pos ) | ROSC_MHZ );
+
+        pBootlog->magic = BOOTLOG_MAGIC;
+        pBootlog->count = 0;
+    }
+}
+
+/* Timestamps a boot phase */
+void bootlogMark( uint32_t phase )
+{
+    if ( pBootlog->count < BOOTLOG_MAX_RECORDS )
+    {
+        pBootlog->record[pBootlog->count].phase = phase;
+        pBootlog->record[pBootlog->count].time  = TIMER->TIMERAWL;
+        pBootlog->count++;
+    }
+}
+
+/* The TIMER ticks every 1us only if the tick generator divides clk_ref by its frequency in MHz.
+   Call it when clk_ref changes (e.g. from ROSC to XOSC) */
+void bootlogSetTick( uint32_t clkRefMhz )
+{
+    WATCHDOG->TICK = ( ( 1 << WATCHDOG_TICK_ENABLE_Pos ) | clkRefMhz );
+}
+
+/* Prints the boot log over the UART (call it after uartConfig()) */
+void bootlogPrint( void )
+{
+    uint32_t previous = pBootlog->record[0].time;
+
+    uartTxStr( "phase               time(us)    delta(us)\r\n" );
+    for ( uint32_t idx = 0; idx < pBootlog->count; idx++ )
+    {
+        if ( pBootlog->record[idx].phase < BOOTLOG_USER )
+        {
+            uartTxStr( ( unsigned char * ) phaseName[pBootlog->record[idx].phase] );
+        }
+        else
+        {
+            uartTxStr( "user phase " );
+            uartPrintDec( pBootlog->record[idx].phase );
+            uartTxStr( "     " );
+        }
+        uartTxStr( "   " );
+        uartPrintDec( pBootlog->record[idx].time );
+        uartTxStr( "    " );
+        uartPrintDec( pBootlog->record[idx].time - previous );
+        uartTxStr( "\r\n" );
+        previous = pBootlog->record[idx].time;
+    }
+    uartTxStr( "(times before 'XOSC stable' are counted from the ROSC: approximate)\r\n" );
+}
@@ -0,0 +1,44 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+
+#ifndef bootlog_0
+#define bootlog_0
+
+#include <stdint.h>
+
+#define BOOTLOG_ADDR         ( 0x20000000 )    // boot2 area in SRAM: not used after boot
+#define BOOTLOG_MAGIC        ( 0xB0071065 )
+#define BOOTLOG_MAX_RECORDS  ( 30 )            // header + records fit on the 256 bytes of the boot2 area
+
+/* Boot phases (BOOTLOG_BOOT2_xx are written by boot2.s) */
+#define BOOTLOG_BOOT2_COPY    ( 0 )    // boot2: start of the flash to SRAM copy
+#define BOOTLOG_BOOT2_DONE    ( 1 )    // boot2: copy done, jump to main
+#define BOOTLOG_MAIN          ( 2 )    // main() entry
+#define BOOTLOG_XOSC_START    ( 3 )    // XOSC enabled
+#define BOOTLOG_XOSC_STABLE   ( 4 )    // XOSC stable
+#define BOOTLOG_RESET_START   ( 5 )    // peripheral reset release started
+#define BOOTLOG_RESET_DONE    ( 6 )    // peripheral reset release done
+#define BOOTLOG_PLL_START     ( 7 )    // PLL powered up
+#define BOOTLOG_PLL_LOCKED    ( 8 )    // PLL locked and clk_sys switched
+#define BOOTLOG_UART_READY    ( 9 )    // UART configured
+#define BOOTLOG_USER          ( 10 )   // first free phase number for the application
+
+typedef struct
+{
+    uint32_t phase;
+    uint32_t time;                     // TIMER value (us)
+} bootlogRecord_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t count;
+    bootlogRecord_t record[BOOTLOG_MAX_RECORDS];
+} bootlog_t;
+
+void bootlogInit( void );
+void bootlogMark( uint32_t phase );
+void bootlogSetTick( uint32_t clkRefMhz );
+void bootlogPrint( void );
+
+#endif
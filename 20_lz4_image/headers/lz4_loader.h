@@ -0,0 +1,20 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+
+#ifndef lz4_loader_0
+#define lz4_loader_0
+
+#include <stdint.h>
+
+#define APP_ADDR             ( 0x20000100 )    // application vector table (decompressed image)
+#define APP_ENTRY            ( 0x20000200 )    // application main()
+#define RAW_COPY_ADDR        ( 0x20020000 )    // destination of the uncompressed copy test
+#define LOADER_REPORT        ( ( volatile uint32_t * ) 0x20000000 )
+
+/* LOADER_REPORT[] content, written by the loader and printed by the application */
+#define REPORT_RAW_CYCLES    ( 0 )    // plain flash to SRAM copy of the application size
+#define REPORT_LZ4_CYCLES    ( 1 )    // LZ4 decompression from flash to SRAM
+#define REPORT_LZ4_SIZE      ( 2 )    // compressed size (bytes read from the flash)
+#define REPORT_APP_SIZE      ( 3 )    // decompressed size
+
+#endif
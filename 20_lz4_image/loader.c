@@ -0,0 +1,223 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include "lz4_loader.h"
+
+#define LZ4_LEGACY_MAGIC     ( 0x184C2102 )
+
+/* Compressed application, placed by memmap.ld */
+extern uint8_t __payload_start__[];
+extern uint8_t __payload_end__[];
+
+/* Read a 32 bit little endian value (the payload is not word aligned) */
+static uint32_t read32( const uint8_t *pSrc )
+{
+    return ( ( uint32_t ) pSrc[0] | ( ( uint32_t ) pSrc[1] << 8 ) | ( ( uint32_t ) pSrc[2] << 16 ) |
+             ( ( uint32_t ) pSrc[3] << 24 ) );
+}
+
+/* Decompress one LZ4 block. Returns the end of the output data, 0 if the block is not valid: it would
+   read past its end, write past pDstEnd or copy a match from before pDstStart.
+   Each sequence is: token, literal length, literals, match offset, match length */
+static uint8_t *lz4DecompressBlock( const uint8_t *pSrc, const uint8_t *pSrcEnd, uint8_t *pDst,
+                                    const uint8_t *pDstStart, const uint8_t *pDstEnd )
+{
+    uint32_t token;
+    uint32_t length;
+    uint32_t extra;
+    const uint8_t *pMatch;
+
+    while ( pSrc < pSrcEnd )
+    {
+        token = *pSrc++;
+
+        // Literals: high nibble of the token (+ extra bytes if 15)
+        length = token >> 4;
+        if ( length == 15 )
+        {
+            do
+            {
+                if ( pSrc >= pSrcEnd )
+                {
+                    return ( 0 );
+                }
+                extra = *pSrc++;
+                length += extra;
+            } while ( extra == 255 );
+        }
+        if ( ( length > ( uint32_t ) ( pSrcEnd - pSrc ) ) || ( length > ( uint32_t ) ( pDstEnd - pDst ) ) )
+        {
+            return ( 0 );
+        }
+        while ( length-- )
+        {
+            *pDst++ = *pSrc++;
+        }
+
+        // The last sequence of a block has only literals
+        if ( pSrc >= pSrcEnd )
+        {
+            break;
+        }
+
+        // Match: copy from the already decompressed data (may overlap)
+        if ( ( pSrcEnd - pSrc ) < 2 )
+        {
+            return ( 0 );
+        }
+        pMatch = pDst - ( pSrc[0] | ( pSrc[1] << 8 ) );
+        pSrc += 2;
+        length = token & 0x0F;
+        if ( length == 15 )
+        {
+            do
+            {
+                if ( pSrc >= pSrcEnd )
+                {
+                    return ( 0 );
+                }
+                extra = *pSrc++;
+                length += extra;
+            } while ( extra == 255 );
+        }
+        length += 4;                                   // minimum match length
+        if ( ( pMatch < pDstStart ) || ( pMatch == pDst ) || ( length > ( uint32_t ) ( pDstEnd - pDst ) ) )
+        {
+            return ( 0 );
+        }
+        while ( length-- )
+        {
+            *pDst++ = *pMatch++;
+        }
+    }
+
+    return ( pDst );
+}
+
+/* Decompress a LZ4 legacy frame ( lz4 -l ): magic, then blocks of [size][data].
+   Returns the number of bytes written, 0 if the payload is not valid or does not fit in dstSize bytes
+   (nothing is written past pDst + dstSize) */
+static uint32_t lz4Decompress( const uint8_t *pSrc, const uint8_t *pSrcEnd, uint8_t *pDst, uint32_t dstSize )
+{
+    uint8_t *pEnd   = pDst + dstSize;
+    uint8_t *pStart = pDst;
+    uint32_t blockSize;
+
+    if ( ( ( pSrcEnd - pSrc ) < 4 ) || ( read32( pSrc ) != LZ4_LEGACY_MAGIC ) )
+    {
+        return ( 0 );
+    }
+    pSrc += 4;
+
+    while ( ( pSrc + 4 ) <= pSrcEnd )
+    {
+        blockSize = read32( pSrc );
+        pSrc += 4;
+        if ( blockSize == LZ4_LEGACY_MAGIC )           // start of a concatenated frame
+        {
+            continue;
+        }
+        if ( blockSize > ( uint32_t ) ( pSrcEnd - pSrc ) )
+        {
+            return ( 0 );
+        }
+        pDst = lz4DecompressBlock( pSrc, pSrc + blockSize, pDst, pStart, pEnd );
+        if ( pDst == 0 )
+        {
+            return ( 0 );
+        }
+        pSrc += blockSize;
+    }
+
+    return ( pDst - pStart );
+}
+
+/* Plain copy from the flash, 16 bytes at a time (same as boot2 _copyToRam) */
+static void rawCopy( const uint32_t *pSrc, uint32_t *pDst, uint32_t size )
+{
+    for ( uint32_t idx = 0; idx < ( size / 4 ); idx += 4 )
+    {
+        pDst[idx + 0] = pSrc[idx + 0];
+        pDst[idx + 1] = pSrc[idx + 1];
+        pDst[idx + 2] = pSrc[idx + 2];
+        pDst[idx + 3] = pSrc[idx + 3];
+    }
+}
+
+/* Flush the XIP cache, so that every test reads from the flash */
+static void xipCacheFlush( void )
+{
+    XIP_CTRL->FLUSH = 1;
+    while ( XIP_CTRL->STAT_b.FLUSH_READY == 0 );
+}
+
+/* SysTick as a free running 24 bit down counter of clk_sys cycles */
+static void cycleCounterRestart( void )
+{
+    PPB->SYST_RVR = 0x00FFFFFF;                      // max reload value
+    PPB->SYST_CVR = 0;                               // clear the current value
+    PPB->SYST_CSR = ( ( 1 << 2 ) | ( 1 << 0 ) );     // source clock = processor clock / enable (no interrupt)
+}
+
+static uint32_t cycleCounterRead( void )
+{
+    return ( 0x00FFFFFF - PPB->SYST_CVR );
+}
+
+/* Handles any error of the loader: blink fast forever (LED on GPIO25) */
+static void loaderError( void )
+{
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+    while ( 1 )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );
+        for ( volatile unsigned int x = 0; x < 50000; x++ );
+    }
+}
+
+/* ***********************************************
+ * Loader (runs from the flash)
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) void loader( void )
+{
+    uint32_t payloadSize = __payload_end__ - __payload_start__;
+    uint32_t appSize;
+    uint32_t rawCycles;
+    uint32_t lz4Cycles;
+    void ( *appMain )( void ) = ( void ( * )( void ) ) ( APP_ENTRY | 1 );    // thumb bit
+
+    // Decompress the application to SRAM
+    xipCacheFlush();
+    cycleCounterRestart();
+    appSize = lz4Decompress( __payload_start__, __payload_end__, ( uint8_t * ) APP_ADDR, RAW_COPY_ADDR - APP_ADDR );
+    lz4Cycles = cycleCounterRead();
+
+    if ( appSize == 0 )
+    {
+        loaderError();
+    }
+
+    // For comparison: read the same number of bytes from the flash without compression, as an
+    // uncompressed image would. This deliberately reads past __payload_end__ (appSize > payloadSize):
+    // only the amount of flash read matters, the copied data is not used
+    xipCacheFlush();
+    cycleCounterRestart();
+    rawCopy( ( uint32_t * ) __payload_start__, ( uint32_t * ) RAW_COPY_ADDR, ( appSize + 15 ) & ~15 );
+    rawCycles = cycleCounterRead();
+    PPB->SYST_CSR = 0;                               // stop SysTick
+
+    LOADER_REPORT[REPORT_RAW_CYCLES] = rawCycles;
+    LOADER_REPORT[REPORT_LZ4_CYCLES] = lz4Cycles;
+    LOADER_REPORT[REPORT_LZ4_SIZE]   = payloadSize;
+    LOADER_REPORT[REPORT_APP_SIZE]   = appSize;
+
+    // Jump to the application
+    PPB->VTOR = APP_ADDR;
+    appMain();
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+#include "lz4_loader.h"
+
+/* Vector Table (placed at 0x20000100 by memmap_app.ld) */
+__attribute__( ( used, section( ".vectors" ) ) ) void ( *vectors[] )( void ) =
+{
+    0,          //  0 stack pointer value (NA)
+    0,          //  1 reset (NA)
+};
+
+/* Setup XOSC and set it a source clock */
+static void setupClocks( void )
+{
+    // Enable the XOSC
+    XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+    XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+    XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+    while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+}
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+}
+
+/* configure LED */
+void ledConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+}
+
+/* 1 second delay */
+void delaySec( int sec )
+{
+    for (unsigned int x = 0; x < ( sec * 1000000 ); x++);
+}
+
+/* Print a report line: label, value and unit */
+static void printLine( unsigned char *label, uint32_t value, unsigned char *unit )
+{
+    uartTxStr( label );
+    uartPrintDec( value );
+    uartTxStr( unit );
+}
+
+/* ***********************************************
+ * Main function
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    // Copy the loader report before anything else can use the bottom of the SRAM
+    uint32_t rawCycles = LOADER_REPORT[REPORT_RAW_CYCLES];
+    uint32_t lz4Cycles = LOADER_REPORT[REPORT_LZ4_CYCLES];
+    uint32_t lz4Size   = LOADER_REPORT[REPORT_LZ4_SIZE];
+    uint32_t appSize   = LOADER_REPORT[REPORT_APP_SIZE];
+
+    // Setup clocks (XOSC as source clk)
+    setupClocks();
+    // Reset Subsystems (IO / PADS)
+    resetSubsys();
+    // Config UART0 (9600 8N1)
+    uartConfig();
+    // Config LED
+    ledConfig();
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "LZ4 compressed image, decompressed to SRAM at boot\r\n\n" );
+
+    printLine( "Image size (SRAM):        ", appSize, " bytes\r\n" );
+    printLine( "Image size (flash, LZ4):  ", lz4Size, " bytes\r\n" );
+    if ( appSize > lz4Size )
+    {
+        printLine( "Flash saved:              ", appSize - lz4Size, " bytes\r\n" );
+    }
+    else
+    {
+        uartTxStr( "Flash saved:              none (image does not compress)\r\n" );
+    }
+    uartTxStr( "\r\n" );
+    printLine( "Load without compression: ", rawCycles, " cycles (ROSC)\r\n" );
+    printLine( "Load with LZ4:            ", lz4Cycles, " cycles (ROSC)\r\n" );
+    if ( lz4Cycles < rawCycles )
+    {
+        printLine( "LZ4 is faster by:         ", rawCycles - lz4Cycles, " cycles\r\n" );
+    }
+    else
+    {
+        printLine( "LZ4 is slower by:         ", lz4Cycles - rawCycles, " cycles\r\n" );
+    }
+
+    while( true )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+        delaySec( 1 );
+    }
+
+    return ( 0 );
+}
@@ -0,0 +1,23 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+
+#ifndef warmboot_0
+#define warmboot_0
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define WARMBOOT_MAGIC        ( 0x3A4B5C6D )
+
+/* WATCHDOG scratch registers used (SCRATCH4..7 are used by the bootrom)
+   SCRATCH0: WARMBOOT_MAGIC
+   SCRATCH1: PLL_SYS configuration ( PRIM post dividers | FBDIV_INT )
+   SCRATCH2: peripherals kept out of reset (RESETS bits)
+   SCRATCH3: free for the application */
+
+bool warmbootCheck( void );
+bool warmbootKept( uint32_t resetMask );
+void warmbootSave( uint32_t keptMask );
+void warmbootRestart( void );
+
+#endif
@@ -0,0 +1,166 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+#include "warmboot.h"
+
+#define ROSC_MHZ         ( 6 )      // clk_ref after boot is the ring oscillator (~6MHz)
+#define XOSC_MHZ         ( 12 )
+#define RESTART_BLINKS   ( 5 )      // LED toggles before the next warm restart
+
+/* Peripherals kept running through a warm restart */
+#define KEPT_PERIPHERALS ( RESETS_RESET_io_bank0_Msk | RESETS_RESET_pads_bank0_Msk | \
+                           RESETS_RESET_uart0_Msk | RESETS_RESET_timer_Msk )
+
+/* TIMER ticks every 1us only if the tick generator divides clk_ref by its frequency in MHz */
+static void setTimerTick( uint32_t clkRefMhz )
+{
+    WATCHDOG->TICK = ( ( 1 << WATCHDOG_TICK_ENABLE_Pos ) | clkRefMhz );
+}
+
+/* Setup XOSC and set it a source clock */
+static void setupClocks( bool warm )
+{
+    if ( !warm )
+    {
+        // Enable the XOSC
+        XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+        XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+        XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+        while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+    }
+    // Warm: the XOSC was not reset, it is already stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+    setTimerTick( XOSC_MHZ );
+}
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+}
+
+/* PLL_SYS at 125MHz ( 12MHz / 1 * 125 = 1500MHz VCO / 6 / 2 ) as clk_sys */
+static void setupPll( bool warm )
+{
+    if ( !warm )
+    {
+        RESETS_CLR->RESET = ( 1 << RESETS_RESET_pll_sys_Pos );
+        while ( RESETS->RESET_DONE_b.pll_sys == 0 );
+
+        PLL_SYS->CS        = ( 1 << PLL_SYS_CS_REFDIV_Pos );                    // REFDIV = 1
+        PLL_SYS->FBDIV_INT = 125;                                               // VCO = 12MHz * 125 = 1500MHz
+        PLL_SYS_CLR->PWR   = ( ( 1 << PLL_SYS_PWR_PD_Pos ) |                    // Power up the PLL and the VCO
+                               ( 1 << PLL_SYS_PWR_VCOPD_Pos ) );
+        while ( PLL_SYS->CS_b.LOCK == 0 );                                      // VCO locked?
+
+        PLL_SYS->PRIM    = ( ( 6 << PLL_SYS_PRIM_POSTDIV1_Pos ) |               // 1500MHz / 6 / 2 = 125MHz
+                             ( 2 << PLL_SYS_PRIM_POSTDIV2_Pos ) );
+        PLL_SYS_CLR->PWR = ( 1 << PLL_SYS_PWR_POSTDIVPD_Pos );                  // Power up the post dividers
+    }
+    // Warm: the PLL was not reset, it is still locked (checked by warmbootCheck())
+
+    CLOCKS->CLK_SYS_CTRL_b.AUXSRC = 0;                                      // CLK SYS AUX = pll_sys
+    CLOCKS->CLK_SYS_CTRL_b.SRC    = 1;                                      // CLK SYS source = clk_sys_aux
+    while ( CLOCKS->CLK_SYS_SELECTED != ( 1 << 1 ) );                       // wait for the glitchless mux
+}
+
+/* Start the TIMER (1us tick) */
+static void timerStart( void )
+{
+    RESETS_CLR->RESET = ( 1 << RESETS_RESET_timer_Pos );
+    while ( RESETS->RESET_DONE_b.timer == 0 );
+}
+
+/* configure LED */
+void ledConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+}
+
+/* 1 second delay (at 125MHz) */
+void delaySec( int sec )
+{
+    for (unsigned int x = 0; x < ( sec * 10000000 ); x++);
+}
+
+/* ***********************************************
+ * Main function
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    bool     warm = warmbootCheck();
+    uint32_t startTime;
+    uint32_t setupTime;
+
+    // The TIMER keeps running through a warm restart
+    if ( !warmbootKept( RESETS_RESET_timer_Msk ) )
+    {
+        timerStart();
+    }
+    setTimerTick( ROSC_MHZ );                // clk_ref runs from the ROSC until setupClocks()
+    startTime = TIMER->TIMERAWL;
+
+    // Setup clocks (XOSC as source clk)
+    setupClocks( warm );
+    // Reset Subsystems (IO / PADS), only if they were reset
+    if ( !warmbootKept( RESETS_RESET_io_bank0_Msk | RESETS_RESET_pads_bank0_Msk ) )
+    {
+        resetSubsys();
+    }
+    // PLL as clk_sys (clk_peri stays on the XOSC)
+    setupPll( warm );
+    // Config UART0 (9600 8N1), only if it was reset
+    if ( !warmbootKept( RESETS_RESET_uart0_Msk ) )
+    {
+        uartConfig();
+    }
+    // Config LED (SIO is always reset)
+    ledConfig();
+
+    setupTime = TIMER->TIMERAWL - startTime;
+    warmbootSave( KEPT_PERIPHERALS );
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    if ( warm )
+    {
+        uartTxStr( "Warm restart: XOSC, PLL and peripherals reused\r\n" );
+    }
+    else
+    {
+        uartTxStr( "Cold boot: full clock and peripheral setup\r\n" );
+        WATCHDOG->SCRATCH3 = setupTime;        // kept for the comparison on the warm restarts
+    }
+    uartTxStr( "Clock and peripheral setup: " );
+    uartPrintDec( setupTime );
+    uartTxStr( " us (cold boot: " );
+    uartPrintDec( WATCHDOG->SCRATCH3 );
+    uartTxStr( " us)\r\n" );
+
+    for ( uint32_t blink = 0; blink < RESTART_BLINKS; blink++ )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+        delaySec( 1 );
+    }
+
+    uartTxStr( "Warm restart...\r\n" );
+    while ( UART0->UARTFR_b.BUSY == 1 );                 // wait for the last character
+    warmbootRestart();
+
+    return ( 0 );
+}
@@ -0,0 +1,75 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include "warmboot.h"
+
+#define PLL_POWER_DOWN_MASK   ( PLL_SYS_PWR_PD_Msk | PLL_SYS_PWR_POSTDIVPD_Msk | PLL_SYS_PWR_VCOPD_Msk )
+#define PSM_ALL_MASK          ( ( 1 << ( PSM_WDSEL_proc1_Pos + 1 ) ) - 1 )
+#define RESETS_ALL_MASK       ( ( 1 << ( RESETS_RESET_usbctrl_Pos + 1 ) ) - 1 )
+
+static uint32_t keptPeripherals;    // valid only after warmbootCheck() returns true
+
+/* PLL_SYS configuration as saved on SCRATCH1 */
+static uint32_t pllConfig( void )
+{
+    return ( ( PLL_SYS->PRIM & ( PLL_SYS_PRIM_POSTDIV1_Msk | PLL_SYS_PRIM_POSTDIV2_Msk ) ) |
+             PLL_SYS->FBDIV_INT );
+}
+
+/* Returns true if this is a warm boot: a watchdog reset issued by warmbootRestart() and
+   the XOSC and PLL_SYS are still running with the saved configuration */
+bool warmbootCheck( void )
+{
+    keptPeripherals = 0;
+
+    if ( ( WATCHDOG->REASON & ( WATCHDOG_REASON_FORCE_Msk | WATCHDOG_REASON_TIMER_Msk ) ) == 0 )
+    {
+        return ( false );    // power on or RUN pin: the scratch registers are not valid
+    }
+    if ( WATCHDOG->SCRATCH0 != WARMBOOT_MAGIC )
+    {
+        return ( false );
+    }
+    if ( XOSC->STATUS_b.STABLE == 0 )
+    {
+        return ( false );
+    }
+    if ( ( RESETS->RESET_DONE_b.pll_sys == 0 ) ||
+         ( PLL_SYS->CS_b.LOCK == 0 ) ||
+         ( ( PLL_SYS->PWR & PLL_POWER_DOWN_MASK ) != 0 ) ||
+         ( pllConfig() != WATCHDOG->SCRATCH1 ) )
+    {
+        return ( false );
+    }
+
+    keptPeripherals = WATCHDOG->SCRATCH2 & RESETS->RESET_DONE;
+    return ( true );
+}
+
+/* Returns true if all the peripherals on resetMask are still out of reset and configured */
+bool warmbootKept( uint32_t resetMask )
+{
+    return ( ( keptPeripherals & resetMask ) == resetMask );
+}
+
+/* Saves the running clock configuration and the peripherals that must survive a warm restart.
+   Call it once the clocks and the peripherals are configured */
+void warmbootSave( uint32_t keptMask )
+{
+    WATCHDOG->SCRATCH1 = pllConfig();
+    WATCHDOG->SCRATCH2 = keptMask;
+    WATCHDOG->SCRATCH0 = WARMBOOT_MAGIC;
+}
+
+/* Restarts both cores through the watchdog, keeping the XOSC, PLL_SYS and the saved peripherals running.
+   The CLOCKS block is reset (clk_sys back to the ring oscillator) so the bootrom and boot2 run as usual */
+void warmbootRestart( void )
+{
+    // Power on state machine: everything but the oscillators and the RESETS block
+    PSM->WDSEL = PSM_ALL_MASK & ~( PSM_WDSEL_rosc_Msk | PSM_WDSEL_xosc_Msk | PSM_WDSEL_resets_Msk );
+    // Peripherals: everything but PLL_SYS and the saved ones
+    RESETS->WDSEL = RESETS_ALL_MASK & ~( RESETS_WDSEL_pll_sys_Msk | WATCHDOG->SCRATCH2 );
+
+    WATCHDOG_SET->CTRL = WATCHDOG_CTRL_TRIGGER_Msk;
+    while ( 1 );
+}
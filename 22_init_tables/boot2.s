@@ -0,0 +1,71 @@
+;@ Copyright (c) 2023 CarlosFTM
+;@ This code is licensed under MIT license (see LICENSE.txt for details)
+
+.cpu cortex-m0plus
+.thumb
+.syntax unified
+
+.set XIP_SSI_BASE,       0x18000000
+.set XIP_SSI_CTRLR0,     XIP_SSI_BASE + 0x00
+.set XIP_SSI_CTRLR1,     XIP_SSI_BASE + 0x04
+.set XIP_SSI_SSIENR,     XIP_SSI_BASE + 0x08
+.set XIP_SSI_BAUDR,      XIP_SSI_BASE + 0x14
+.set XIP_SSI_SPI_CTRLR0, XIP_SSI_BASE + 0xF4
+.set VTOR,               0xE000ED08
+
+.set FLASH_IMAGE,        0x10000100    ;@ the image starts after the 256 bytes of boot2
+.set SRAM_IMAGE,         0x20000100
+.set IMAGE_HEADER,       0xF0          ;@ offset of the image header (size and stack top) written by memmap.ld
+
+.section .boot2, "ax"
+    ldr r0, =XIP_SSI_SSIENR
+    ldr r1, =0x00000000
+    str r1, [r0]
+
+    ldr r0, =XIP_SSI_CTRLR0
+    ldr r1, =0x001F0300
+    str r1, [r0]
+
+    ldr r0, =XIP_SSI_BAUDR
+    ldr r1, =0x00000008
+    str r1, [r0]
+
+    ldr r0, =XIP_SSI_SPI_CTRLR0
+    ldr r1, =0x03000218
+    str r1, [r0]
+
+    ldr r0, =XIP_SSI_CTRLR1
+    ldr r1, =0x00000000
+    str r1, [r0]
+
+    ldr r0, =XIP_SSI_SSIENR
+    ldr r1, =0x00000001
+    str r1, [r0]
+
+    ldr r4, =FLASH_IMAGE ;@ Source address (FLASH)
+    ldr r5, =SRAM_IMAGE  ;@ Destination (SRAM)
+    movs r0, #IMAGE_HEADER
+    ldr r6, [r4, r0]     ;@ Size of code (multiple of 32 bytes)
+
+_copyToRam:
+    ;@ load 32 bytes from FLASH to RAM at a time
+    ldmia r4!, {r0-r2, r7}
+    stmia r5!, {r0-r2, r7}
+    ldmia r4!, {r0-r2, r7}
+    stmia r5!, {r0-r2, r7}
+    subs  r6, #32
+    bhi   _copyToRam
+
+    ;@ Jump to the main function
+    ldr r1, =VTOR
+    ldr r0, =SRAM_IMAGE
+    str r0, [r1]
+
+    ldr r2, =(SRAM_IMAGE + IMAGE_HEADER)
+    ldr r0, [r2, #4]      ;@ stack top from the image header
+    mov sp, r0
+
+    ldr r0, =0x20000201
+    bx  r0
+
+.end
@@ -0,0 +1,32 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+
+#ifndef init_table_0
+#define init_table_0
+
+#include <stdint.h>
+
+/* Operation of a table entry */
+#define INIT_WRITE   ( 0 )    // reg  = value
+#define INIT_SET     ( 1 )    // reg |= value  (atomic SET alias, not for SIO / PPB registers)
+#define INIT_CLR     ( 2 )    // reg &= ~value (atomic CLR alias, not for SIO / PPB registers)
+#define INIT_WAIT    ( 3 )    // wait until all the bits of value are set on reg
+
+typedef struct
+{
+    uint32_t op;
+    volatile uint32_t *pReg;
+    uint32_t value;
+} initReg_t;
+
+/* Table entry: INIT_REG( INIT_WRITE, UART0->UARTIBRD, 78 ) */
+#define INIT_REG( op, reg, value )   { ( op ), &( reg ), ( value ) }
+
+/* Apply a table: INIT_APPLY( resetMask, table ) */
+#define INIT_APPLY( resetMask, table ) \
+    initApply( ( resetMask ), ( table ), ( sizeof( table ) / sizeof( ( table )[0] ) ) )
+
+void initResetRelease( uint32_t resetMask );
+void initApply( uint32_t resetMask, const initReg_t *pTable, uint32_t count );
+
+#endif
@@ -0,0 +1,47 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include "init_table.h"
+
+#define ALIAS_SET    ( 0x2000 )    // atomic bitmask set alias
+#define ALIAS_CLR    ( 0x3000 )    // atomic bitmask clear alias
+
+/* Releases all the peripherals of resetMask with a single write, and waits once for all of them */
+void initResetRelease( uint32_t resetMask )
+{
+    RESETS_CLR->RESET = resetMask;
+    while ( ( RESETS->RESET_DONE & resetMask ) != resetMask );
+}
+
+/* Releases the resets and then applies the register table in order */
+void initApply( uint32_t resetMask, const initReg_t *pTable, uint32_t count )
+{
+    if ( resetMask != 0 )
+    {
+        initResetRelease( resetMask );
+    }
+
+    for ( uint32_t idx = 0; idx < count; idx++ )
+    {
+        volatile uint32_t *pReg  = pTable[idx].pReg;
+        uint32_t           value = pTable[idx].value;
+
+        switch ( pTable[idx].op )
+        {
+            case INIT_WRITE:
+                *pReg = value;
+                break;
+            case INIT_SET:
+                *( volatile uint32_t * ) ( ( uint32_t ) pReg + ALIAS_SET ) = value;
+                break;
+            case INIT_CLR:
+                *( volatile uint32_t * ) ( ( uint32_t ) pReg + ALIAS_CLR ) = value;
+                break;
+            case INIT_WAIT:
+                while ( ( *pReg & value ) != value );
+                break;
+            default:
+                break;
+        }
+    }
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+#include "init_table.h"
+
+/* Peripherals used in this program */
+#define PERIPH_RESETS  ( RESETS_RESET_io_bank0_Msk | RESETS_RESET_pads_bank0_Msk | \
+                         RESETS_RESET_uart0_Msk | RESETS_RESET_i2c0_Msk | RESETS_RESET_adc_Msk )
+
+/* XOSC as source clock for REF, SYS, PERI and ADC */
+static const initReg_t clockTable[] =
+{
+    INIT_REG( INIT_WRITE, XOSC->CTRL,             0xAA0 ),                                    // Frequency range: 1_15MHZ
+    INIT_REG( INIT_WRITE, XOSC->STARTUP,          ( 0xC4 << XOSC_STARTUP_DELAY_Pos ) ),       // Startup delay ( default value )
+    INIT_REG( INIT_SET,   XOSC->CTRL,             0xFAB000 ),                                 // Enable ( magic word )
+    INIT_REG( INIT_WAIT,  XOSC->STATUS,           XOSC_STATUS_STABLE_Msk ),                   // Oscillator is running and stable
+    INIT_REG( INIT_WRITE, CLOCKS->CLK_REF_CTRL,   ( 2 << CLOCKS_CLK_REF_CTRL_SRC_Pos ) ),     // CLK REF source = xosc_clksrc
+    INIT_REG( INIT_WRITE, CLOCKS->CLK_SYS_CTRL,   0 ),                                        // CLK SYS source = clk_ref
+    INIT_REG( INIT_WRITE, CLOCKS->CLK_REF_DIV,    ( 1 << CLOCKS_CLK_REF_DIV_INT_Pos ) ),      // CLK REF Divisor = 1
+    INIT_REG( INIT_WRITE, CLOCKS->CLK_PERI_CTRL,  ( ( 1 << CLOCKS_CLK_PERI_CTRL_ENABLE_Pos ) |  // CLK PERI Enable
+                                                    ( 4 << CLOCKS_CLK_PERI_CTRL_AUXSRC_Pos ) ) ), // CLK PERI AUX SRC = xosc_clksrc
+    INIT_REG( INIT_WRITE, CLOCKS->CLK_ADC_CTRL,   ( ( 1 << CLOCKS_CLK_ADC_CTRL_ENABLE_Pos ) |   // CLK ADC Enable
+                                                    ( 3 << CLOCKS_CLK_ADC_CTRL_AUXSRC_Pos ) ) ),  // CLK ADC AUX SRC = xosc_clksrc
+};
+
+/* Peripheral registers, applied once all the resets are released */
+static const initReg_t periphTable[] =
+{
+    // UART0: 9600 8N1 (clk_peri = 12MHz)
+    INIT_REG( INIT_WRITE, UART0->UARTIBRD,        78 ),
+    INIT_REG( INIT_WRITE, UART0->UARTFBRD,        8 ),
+    INIT_REG( INIT_WRITE, UART0->UARTLCR_H,       ( ( 1 << UART0_UARTLCR_H_FEN_Pos ) | ( 3 << UART0_UARTLCR_H_WLEN_Pos ) ) ),
+    INIT_REG( INIT_WRITE, UART0->UARTCR,          ( ( 1 << UART0_UARTCR_RXE_Pos ) | ( 1 << UART0_UARTCR_TXE_Pos ) |
+                                                    ( 1 << UART0_UARTCR_UARTEN_Pos ) ) ),
+    INIT_REG( INIT_WRITE, IO_BANK0->GPIO0_CTRL,   ( 2 << IO_BANK0_GPIO0_CTRL_FUNCSEL_Pos ) ), // GPIO0 = UART0 TX
+    INIT_REG( INIT_WRITE, IO_BANK0->GPIO1_CTRL,   ( 2 << IO_BANK0_GPIO1_CTRL_FUNCSEL_Pos ) ), // GPIO1 = UART0 RX
+
+    // I2C0: master, fast mode (400kbps with clk_sys @ 12MHZ), 7-bit addressing, on GPIO20 / 21
+    INIT_REG( INIT_WRITE, I2C0->IC_ENABLE,        0 ),
+    INIT_REG( INIT_WRITE, I2C0->IC_CON,           ( ( 1 << I2C0_IC_CON_MASTER_MODE_Pos ) |
+                                                    ( I2C0_IC_CON_SPEED_FAST << I2C0_IC_CON_SPEED_Pos ) |
+                                                    ( 1 << I2C0_IC_CON_IC_SLAVE_DISABLE_Pos ) |
+                                                    ( 1 << I2C0_IC_CON_TX_EMPTY_CTRL_Pos ) ) ),
+    INIT_REG( INIT_WRITE, I2C0->IC_FS_SCL_HCNT,   71 ),
+    INIT_REG( INIT_WRITE, I2C0->IC_FS_SCL_LCNT,   16 ),
+    INIT_REG( INIT_WRITE, I2C0->IC_FS_SPKLEN,     1 ),
+    INIT_REG( INIT_WRITE, I2C0->IC_SDA_HOLD,      0 ),
+    INIT_REG( INIT_WRITE, IO_BANK0->GPIO20_CTRL,  ( 3 << IO_BANK0_GPIO20_CTRL_FUNCSEL_Pos ) ), // GPIO20 = I2C0 SDA
+    INIT_REG( INIT_WRITE, IO_BANK0->GPIO21_CTRL,  ( 3 << IO_BANK0_GPIO21_CTRL_FUNCSEL_Pos ) ), // GPIO21 = I2C0 SCL
+    INIT_REG( INIT_CLR,   PADS_BANK0->GPIO20,     PADS_BANK0_GPIO20_PDE_Msk ),                 // Pull Up (I2C)
+    INIT_REG( INIT_SET,   PADS_BANK0->GPIO20,     PADS_BANK0_GPIO20_PUE_Msk ),
+    INIT_REG( INIT_CLR,   PADS_BANK0->GPIO21,     PADS_BANK0_GPIO21_PDE_Msk ),
+    INIT_REG( INIT_SET,   PADS_BANK0->GPIO21,     PADS_BANK0_GPIO21_PUE_Msk ),
+    INIT_REG( INIT_WRITE, I2C0->IC_ENABLE,        1 ),
+
+    // ADC: temperature sensor (input 4)
+    INIT_REG( INIT_WRITE, ADC->CS,                ( ( 4 << ADC_CS_AINSEL_Pos ) | ADC_CS_TS_EN_Msk | ADC_CS_EN_Msk ) ),
+    INIT_REG( INIT_WAIT,  ADC->CS,                ADC_CS_READY_Msk ),
+
+    // LED: GPIO25 as SIO (F5) and GPIO OE
+    INIT_REG( INIT_WRITE, IO_BANK0->GPIO25_CTRL,  ( 5 << IO_BANK0_GPIO25_CTRL_FUNCSEL_Pos ) ),
+    INIT_REG( INIT_WRITE, SIO->GPIO_OE_SET,       ( 1 << 25 ) ),
+};
+
+/* SysTick as a free running 24 bit down counter of clk_sys cycles */
+static void cycleCounterStart( void )
+{
+    PPB->SYST_RVR = 0x00FFFFFF;                      // max reload value
+    PPB->SYST_CVR = 0;                               // clear the current value
+    PPB->SYST_CSR = ( ( 1 << 2 ) | ( 1 << 0 ) );     // source clock = processor clock / enable (no interrupt)
+}
+
+/* Reset release one peripheral at a time (as on the other examples). Returns the clk_sys cycles */
+static uint32_t timedResetOneByOne( void )
+{
+    uint32_t start;
+    uint32_t end;
+
+    RESETS_SET->RESET = PERIPH_RESETS;
+    start = PPB->SYST_CVR;
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+    RESETS_CLR->RESET_b.uart0 = 1;
+    while ( RESETS->RESET_DONE_b.uart0 == 0 );
+    RESETS_CLR->RESET_b.i2c0 = 1;
+    while ( RESETS->RESET_DONE_b.i2c0 == 0 );
+    RESETS_CLR->RESET_b.adc = 1;
+    while ( RESETS->RESET_DONE_b.adc == 0 );
+    end = PPB->SYST_CVR;
+
+    return ( ( start - end ) & 0x00FFFFFF );         // SysTick counts down
+}
+
+/* Reset release of all the peripherals with one write. Returns the clk_sys cycles */
+static uint32_t timedResetBatched( void )
+{
+    uint32_t start;
+    uint32_t end;
+
+    RESETS_SET->RESET = PERIPH_RESETS;
+    start = PPB->SYST_CVR;
+    initResetRelease( PERIPH_RESETS );
+    end = PPB->SYST_CVR;
+
+    return ( ( start - end ) & 0x00FFFFFF );         // SysTick counts down
+}
+
+/* 1 second delay */
+void delaySec( int sec )
+{
+    for (unsigned int x = 0; x < ( sec * 1000000 ); x++);
+}
+
+/* ***********************************************
+ * Main function
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    uint32_t cyclesOneByOne;
+    uint32_t cyclesBatched;
+    uint32_t cyclesTable;
+    uint32_t start;
+
+    // Setup clocks (XOSC as source clk)
+    INIT_APPLY( 0, clockTable );
+
+    // Compare both ways of releasing the resets (before the peripherals are configured)
+    cycleCounterStart();
+    cyclesOneByOne = timedResetOneByOne();
+    cyclesBatched  = timedResetBatched();
+
+    // Reset, release and configure IO / PADS, UART0, I2C0, ADC and the LED in one pass
+    RESETS_SET->RESET = PERIPH_RESETS;
+    start = PPB->SYST_CVR;
+    INIT_APPLY( PERIPH_RESETS, periphTable );
+    cyclesTable = ( start - PPB->SYST_CVR ) & 0x00FFFFFF;
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "Table driven peripheral init\r\n\n" );
+    uartTxStr( "Reset release, one by one:    " );
+    uartPrintDec( cyclesOneByOne );
+    uartTxStr( " cycles\r\n" );
+    uartTxStr( "Reset release, single write:  " );
+    uartPrintDec( cyclesBatched );
+    uartTxStr( " cycles\r\n" );
+    uartTxStr( "Full peripheral table:        " );
+    uartPrintDec( cyclesTable );
+    uartTxStr( " cycles (" );
+    uartPrintDec( sizeof( periphTable ) / sizeof( periphTable[0] ) );
+    uartTxStr( " entries)\r\n" );
+
+    while( true )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+        delaySec( 1 );
+    }
+
+    return ( 0 );
+}
@@ -0,0 +1,16 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+
+#ifndef uart0_0
+#define uart0_0
+
+void uartConfig( void );
+unsigned char uartRx( void );
+void uartTx( unsigned char x );
+void uartTxStr( unsigned char *x );
+void uartPrintByte( unsigned char data );
+void uartPrintDW( unsigned int data );
+unsigned char uartRxNoBlocking( void );
+void uartPrintDec( unsigned int data );
+
+#endif
\ No newline at end of file
@@ -0,0 +1,303 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+
+#define __sram4         __attribute__( ( section( ".sram4" ) ) )
+#define __sram_striped  __attribute__( ( section( ".sram_striped" ) ) )
+
+#define STACK_WORDS     ( 64 )          // local array of the stack workload
+#define WORK_LOOPS      ( 200 )
+#define DMA_RING_WORDS  ( 256 )         // 1KB write ring
+#define DMA_MAX_COUNT   ( 0x00FFFFFF )  // more than the workload time
+
+/* Bus fabric performance counter events */
+#define PERF_SRAM0_CONTESTED  ( 14 )
+#define PERF_SRAM4_CONTESTED  ( 6 )
+#define PERF_SRAM5_CONTESTED  ( 4 )
+
+/* Linker symbols (memmap.ld) */
+extern uint32_t __stack1_top__[];
+extern uint32_t __stack1_shared_top__[];
+
+/* DMA buffer: the write ring must be aligned to its size */
+typedef struct
+{
+    uint32_t ring[DMA_RING_WORDS];
+    uint32_t source;
+} dmaBuffer_t;
+
+__sram4         __attribute__( ( aligned( 1024 ) ) ) dmaBuffer_t dmaBufferSram4;
+__sram_striped  __attribute__( ( aligned( 1024 ) ) ) dmaBuffer_t dmaBufferStriped;
+
+/* Placement of the core1 stack and the DMA buffer. The core0 stack is always on SRAM4 */
+typedef struct
+{
+    unsigned char *name;
+    uint32_t      *pStack1Top;
+    dmaBuffer_t   *pDmaBuffer;
+} testCase_t;
+
+/* Results of a test */
+typedef struct
+{
+    uint32_t core0Cycles;
+    uint32_t core1Cycles;
+    uint32_t dmaWords;
+    uint32_t sram4Contested;
+    uint32_t sram5Contested;
+    uint32_t sram0Contested;
+} testResult_t;
+
+/* Vector Table (core1 needs one to be launched) */
+__attribute__( ( used, section( ".vectors" ) ) ) void ( *vectors[] )( void ) =
+{
+    0,          //  0 stack pointer value (NA)
+    0,          //  1 reset (NA)
+};
+
+/* Setup XOSC and set it a source clock */
+static void setupClocks( void )
+{
+    // Enable the XOSC
+    XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+    XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+    XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+    while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+}
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+
+    // Reset DMA
+    RESETS_CLR->RESET_b.dma = 1;
+    while ( RESETS->RESET_DONE_b.dma == 0 );
+}
+
+/* configure LED */
+void ledConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+}
+
+/* 1 second delay */
+void delaySec( int sec )
+{
+    for (unsigned int x = 0; x < ( sec * 1000000 ); x++);
+}
+
+/* Workload on the stack of the calling core (-O0: the loop variables are on the stack too).
+   Returns the clk_sys cycles, measured with the SysTick of the calling core */
+static uint32_t stackWork( void )
+{
+    volatile uint32_t local[STACK_WORDS];
+    uint32_t start;
+
+    PPB->SYST_RVR = 0x00FFFFFF;                      // max reload value
+    PPB->SYST_CVR = 0;                               // clear the current value
+    PPB->SYST_CSR = ( ( 1 << 2 ) | ( 1 << 0 ) );     // source clock = processor clock / enable (no interrupt)
+
+    start = PPB->SYST_CVR;
+    for ( uint32_t loop = 0; loop < WORK_LOOPS; loop++ )
+    {
+        for ( uint32_t idx = 0; idx < STACK_WORDS; idx++ )
+        {
+            local[idx] += idx;
+        }
+    }
+
+    return ( ( start - PPB->SYST_CVR ) & 0x00FFFFFF ); // SysTick counts down
+}
+
+/* Core1: wait for the start command, run the workload and send back its cycles */
+static void core1Main( void )
+{
+    while ( SIO->FIFO_ST_b.VLD == 0 );
+    ( void ) SIO->FIFO_RD;
+
+    SIO->FIFO_WR = stackWork();
+
+    while ( 1 )
+    {
+        __asm volatile ( "wfe" );
+    }
+}
+
+/* Hold core1 in reset and release it: it goes back to the bootrom, waiting for a launch */
+static void resetCore1( void )
+{
+    PSM_SET->FRCE_OFF = PSM_FRCE_OFF_proc1_Msk;
+    while ( ( PSM->FRCE_OFF & PSM_FRCE_OFF_proc1_Msk ) == 0 );
+    PSM_CLR->FRCE_OFF = PSM_FRCE_OFF_proc1_Msk;
+}
+
+/* Launch core1 with the bootrom FIFO sequence (0, 0, 1, vector table, stack pointer, entry) */
+static void launchCore1( void ( *entry )( void ), uint32_t *pStackTop )
+{
+    uint32_t cmd[6];
+    uint32_t idx = 0;
+
+    cmd[0] = 0;
+    cmd[1] = 0;
+    cmd[2] = 1;
+    cmd[3] = ( uint32_t ) vectors;          // Vector table
+    cmd[4] = ( uint32_t ) pStackTop;        // Core1 stack pointer
+    cmd[5] = ( uint32_t ) entry;            // Core1 main function
+
+    while ( idx < 6 )
+    {
+        if ( cmd[idx] == 0 )
+        {
+            while ( SIO->FIFO_ST_b.VLD == 1 )  // empty the RX FIFO before a 0 command
+            {
+                ( void ) SIO->FIFO_RD;
+            }
+            __asm volatile ( "sev" );
+        }
+        while ( SIO->FIFO_ST_b.RDY == 0 );
+        SIO->FIFO_WR = cmd[idx];
+        __asm volatile ( "sev" );
+        while ( SIO->FIFO_ST_b.VLD == 0 );
+        if ( SIO->FIFO_RD == cmd[idx] )     // core1 echoes every command back
+        {
+            idx++;
+        }
+        else
+        {
+            idx = 0;                        // wrong answer: start again
+        }
+    }
+}
+
+/* DMA channel 0: memory to memory, inside the buffer (one read word, 1KB write ring) */
+static void dmaStart( dmaBuffer_t *pBuffer )
+{
+    DMA->CH0_READ_ADDR   = ( uint32_t ) &pBuffer->source;
+    DMA->CH0_WRITE_ADDR  = ( uint32_t ) pBuffer->ring;
+    DMA->CH0_TRANS_COUNT = DMA_MAX_COUNT;
+    DMA->CH0_CTRL_TRIG   = ( ( 0x3F << DMA_CH0_CTRL_TRIG_TREQ_SEL_Pos ) |     // unpaced: as fast as possible
+                             ( 0 << DMA_CH0_CTRL_TRIG_CHAIN_TO_Pos ) |        // chain to itself = no chain
+                             ( 1 << DMA_CH0_CTRL_TRIG_RING_SEL_Pos ) |        // ring on the write address
+                             ( 10 << DMA_CH0_CTRL_TRIG_RING_SIZE_Pos ) |      // 1 << 10 = 1KB ring
+                             ( 1 << DMA_CH0_CTRL_TRIG_INCR_WRITE_Pos ) |
+                             ( 2 << DMA_CH0_CTRL_TRIG_DATA_SIZE_Pos ) |       // 32 bit
+                             ( 1 << DMA_CH0_CTRL_TRIG_EN_Pos ) );
+}
+
+/* Stop the DMA and return the number of words it transferred */
+static uint32_t dmaStop( void )
+{
+    uint32_t words = DMA_MAX_COUNT - DMA->CH0_TRANS_COUNT;
+
+    DMA->CHAN_ABORT = 1;
+    while ( ( DMA->CHAN_ABORT & 1 ) != 0 );
+    return ( words );
+}
+
+/* Run both cores and the DMA at the same time with the placement of pCase */
+static void runTest( const testCase_t *pCase, testResult_t *pResult )
+{
+    resetCore1();
+    launchCore1( core1Main, pCase->pStack1Top );
+
+    // Bus fabric counters of contested accesses (cleared on write)
+    BUSCTRL->PERFSEL0 = PERF_SRAM4_CONTESTED;
+    BUSCTRL->PERFSEL1 = PERF_SRAM5_CONTESTED;
+    BUSCTRL->PERFSEL2 = PERF_SRAM0_CONTESTED;
+    BUSCTRL->PERFCTR0 = 0;
+    BUSCTRL->PERFCTR1 = 0;
+    BUSCTRL->PERFCTR2 = 0;
+
+    dmaStart( pCase->pDmaBuffer );
+    SIO->FIFO_WR = 1;                                   // core1: start
+    pResult->core0Cycles = stackWork();
+    while ( SIO->FIFO_ST_b.VLD == 0 );
+    pResult->core1Cycles = SIO->FIFO_RD;
+    pResult->dmaWords = dmaStop();
+
+    pResult->sram4Contested = BUSCTRL->PERFCTR0;
+    pResult->sram5Contested = BUSCTRL->PERFCTR1;
+    pResult->sram0Contested = BUSCTRL->PERFCTR2;
+}
+
+static void printResult( const testCase_t *pCase, const testResult_t *pResult )
+{
+    uartTxStr( pCase->name );
+    uartTxStr( "\r\n  core0 cycles:          " );
+    uartPrintDec( pResult->core0Cycles );
+    uartTxStr( "\r\n  core1 cycles:          " );
+    uartPrintDec( pResult->core1Cycles );
+    uartTxStr( "\r\n  DMA words:             " );
+    uartPrintDec( pResult->dmaWords );
+    uartTxStr( "\r\n  SRAM4 contested:       " );
+    uartPrintDec( pResult->sram4Contested );
+    uartTxStr( "\r\n  SRAM5 contested:       " );
+    uartPrintDec( pResult->sram5Contested );
+    uartTxStr( "\r\n  SRAM0 contested:       " );
+    uartPrintDec( pResult->sram0Contested );
+    uartTxStr( "\r\n\n" );
+}
+
+/* ***********************************************
+ * Main function
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    const testCase_t sharedCase =
+    {
+        "Shared: both stacks and DMA on SRAM4",
+        __stack1_shared_top__,
+        &dmaBufferSram4,
+    };
+    const testCase_t splitCase =
+    {
+        "Bank aware: core0 SRAM4, core1 SRAM5, DMA SRAM0-3",
+        __stack1_top__,
+        &dmaBufferStriped,
+    };
+    testResult_t result;
+
+    // Setup clocks (XOSC as source clk)
+    setupClocks();
+    // Reset Subsystems (IO / PADS / DMA)
+    resetSubsys();
+    // Config UART0 (9600 8N1)
+    uartConfig();
+    // Config LED
+    ledConfig();
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "SRAM bank contention: 2 cores + DMA\r\n\n" );
+
+    runTest( &sharedCase, &result );
+    printResult( &sharedCase, &result );
+
+    runTest( &splitCase, &result );
+    printResult( &splitCase, &result );
+
+    while( true )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+        delaySec( 1 );
+    }
+
+    return ( 0 );
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include "xip_cache.h"
+#include "uart.h"
+
+/* Hot region (memmap.ld) */
+extern uint8_t __xip_hot_start__[];
+extern uint8_t __xip_hot_end__[];
+
+/* Unsigned division with the SIO hardware divider (the Cortex-M0+ has no divide instruction) */
+static uint32_t hwDivide( uint32_t dividend, uint32_t divisor )
+{
+    SIO->DIV_UDIVIDEND = dividend;
+    SIO->DIV_UDIVISOR  = divisor;
+    while ( SIO->DIV_CSR_b.READY == 0 );    // result is ready after 8 cycles
+    return ( SIO->DIV_QUOTIENT );
+}
+
+/* Enable the cache. It is flushed first: its data memory may have been used as SRAM */
+void xipCacheEnable( void )
+{
+    xipCacheFlush();
+    XIP_CTRL_SET->CTRL = XIP_CTRL_CTRL_EN_Msk;
+}
+
+/* Disable the cache: every XIP access goes to the flash */
+void xipCacheDisable( void )
+{
+    XIP_CTRL_CLR->CTRL = XIP_CTRL_CTRL_EN_Msk;
+}
+
+bool xipCacheIsEnabled( void )
+{
+    return ( XIP_CTRL->CTRL_b.EN == 1 );
+}
+
+/* Invalidate all the lines (the data memory is not cleared) */
+void xipCacheFlush( void )
+{
+    XIP_CTRL->FLUSH = 1;
+    while ( XIP_CTRL->STAT_b.FLUSH_READY == 0 );
+}
+
+/* Load a flash region in the cache: one read per cache line, on the allocating alias.
+   The lines stay until they are evicted by other allocating reads of the same set:
+   read other bulk data through XIP_NOALLOC() to keep them */
+void xipCachePreload( const void *pStart, uint32_t size )
+{
+    uint32_t addr = ( ( uint32_t ) pStart & 0x00FFFFFF ) | XIP_BASE;
+    uint32_t end  = addr + size;
+
+    for ( addr &= ~( XIP_CACHE_LINE - 1 ); addr < end; addr += XIP_CACHE_LINE )
+    {
+        ( void ) *( volatile uint32_t * ) addr;
+    }
+}
+
+/* Load the __xip_hot_func / __xip_hot_data region in the cache */
+void xipCachePreloadHot( void )
+{
+    xipCachePreload( __xip_hot_start__, __xip_hot_end__ - __xip_hot_start__ );
+}
+
+/* Disable the cache and return its data memory (XIP_CACHE_SIZE bytes) to be used as SRAM.
+   Call xipCacheEnable() to use it as cache again */
+uint32_t *xipCacheAsSram( void )
+{
+    xipCacheDisable();
+    return ( ( uint32_t * ) XIP_SRAM_BASE );
+}
+
+/* Clear the hit and access counters (write any value) */
+void xipCacheCountersReset( void )
+{
+    XIP_CTRL->CTR_HIT = 0;
+    XIP_CTRL->CTR_ACC = 0;
+}
+
+uint32_t xipCacheHits( void )
+{
+    return ( XIP_CTRL->CTR_HIT );
+}
+
+uint32_t xipCacheAccesses( void )
+{
+    return ( XIP_CTRL->CTR_ACC );
+}
+
+/* Print hits, accesses and hit rate (%) since the last xipCacheCountersReset() */
+void xipCachePrintStats( void )
+{
+    uint32_t hits     = XIP_CTRL->CTR_HIT;
+    uint32_t accesses = XIP_CTRL->CTR_ACC;
+
+    uartTxStr( "hits " );
+    uartPrintDec( hits );
+    uartTxStr( " / accesses " );
+    uartPrintDec( accesses );
+    if ( accesses != 0 )
+    {
+        uartTxStr( " = " );
+        // hits * 100 overflows above 42M hits: scale both down first
+        while ( hits > 0x00FFFFFF )
+        {
+            hits >>= 1;
+            accesses >>= 1;
+        }
+        uartPrintDec( hwDivide( hits * 100, accesses ) );
+        uartTxStr( "%" );
+    }
+    uartTxStr( "\r\n" );
+}
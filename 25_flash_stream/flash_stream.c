@@ -0,0 +1,53 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include "flash_stream.h"
+
+#define XIP_AUX_BASE      ( 0x50400000 )   // STREAM_FIFO on the fast AHB-Lite port (DMA access)
+#define DREQ_XIP_STREAM   ( 37 )
+
+/* Bulk flash reads with the XIP stream FIFO and the DMA channel 0.
+   The stream reads the flash in the background, without looking up or filling the XIP cache,
+   so the code and constants already in the cache are not evicted. */
+
+/* Start the read of words 32 bit words from the flash (0x10xxxxxx) to pDst. Returns immediately */
+void flashStreamStart( const void *pFlash, uint32_t *pDst, uint32_t words )
+{
+    // Stop any previous stream and empty the FIFO
+    XIP_CTRL->STREAM_CTR = 0;
+    while ( XIP_CTRL->STAT_b.FIFO_EMPTY == 0 )
+    {
+        ( void ) XIP_CTRL->STREAM_FIFO;
+    }
+
+    // DMA: FIFO to SRAM, paced by the stream FIFO data request
+    DMA->CH0_READ_ADDR   = XIP_AUX_BASE;
+    DMA->CH0_WRITE_ADDR  = ( uint32_t ) pDst;
+    DMA->CH0_TRANS_COUNT = words;
+    DMA->CH0_CTRL_TRIG   = ( ( DREQ_XIP_STREAM << DMA_CH0_CTRL_TRIG_TREQ_SEL_Pos ) |
+                             ( 0 << DMA_CH0_CTRL_TRIG_CHAIN_TO_Pos ) |        // chain to itself = no chain
+                             ( 1 << DMA_CH0_CTRL_TRIG_INCR_WRITE_Pos ) |
+                             ( 2 << DMA_CH0_CTRL_TRIG_DATA_SIZE_Pos ) |       // 32 bit
+                             ( 1 << DMA_CH0_CTRL_TRIG_EN_Pos ) );
+
+    // Stream: the flash address and the number of words start the read
+    XIP_CTRL->STREAM_ADDR = ( uint32_t ) pFlash;
+    XIP_CTRL->STREAM_CTR  = words;
+}
+
+bool flashStreamBusy( void )
+{
+    return ( DMA->CH0_CTRL_TRIG_b.BUSY == 1 );
+}
+
+void flashStreamWait( void )
+{
+    while ( flashStreamBusy() );
+}
+
+/* Blocking read */
+void flashStreamRead( const void *pFlash, uint32_t *pDst, uint32_t words )
+{
+    flashStreamStart( pFlash, pDst, words );
+    flashStreamWait();
+}
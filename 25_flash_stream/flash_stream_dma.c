@@ -0,0 +1,203 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+#include "xip_cache.h"
+#include "flash_stream.h"
+
+#define CLK_SYS_HZ        ( 12000000 )                 // XOSC as clk_sys
+#define HOT_TABLE_WORDS   ( 256 )
+#define HOT_LOOPS         ( 16 )
+#define BULK_ADDR         ( XIP_BASE + 0x00100000 )    // bulk read only data: 1MB offset
+#define BULK_SIZE         ( 16 * 1024 )                // as big as the cache
+#define BULK_WORDS        ( BULK_SIZE / 4 )
+
+/* Linker symbols (memmap.ld) */
+extern uint32_t __data_load__[];
+extern uint32_t __data_start__[];
+extern uint32_t __data_end__[];
+
+volatile uint32_t readChecksum;            // keeps the reads from being optimized out
+uint32_t bulkBuffer[BULK_WORDS];           // destination of the bulk reads (SRAM)
+
+/* Hot constants: read by hotWork() on every loop */
+__xip_hot_data const uint32_t hotTable[HOT_TABLE_WORDS] =
+{
+    0x00000001, 0x00000002, 0x00000004, 0x00000008, 0x00000010, 0x00000020, 0x00000040, 0x00000080,
+};
+
+/* Setup XOSC and set it a source clock */
+static void setupClocks( void )
+{
+    // Enable the XOSC
+    XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+    XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+    XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+    while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+}
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+
+    // Reset DMA
+    RESETS_CLR->RESET_b.dma = 1;
+    while ( RESETS->RESET_DONE_b.dma == 0 );
+}
+
+/* configure LED */
+void ledConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+}
+
+/* 1 second delay */
+void delaySec( int sec )
+{
+    for (unsigned int x = 0; x < ( sec * 1000000 ); x++);
+}
+
+/* Copy a section from its load address (flash) to its run address (SRAM) */
+static void copySection( uint32_t *pLoad, uint32_t *pStart, uint32_t *pEnd )
+{
+    while ( pStart < pEnd )
+    {
+        *pStart++ = *pLoad++;
+    }
+}
+
+/* Unsigned division with the SIO hardware divider (the Cortex-M0+ has no divide instruction) */
+static uint32_t hwDivide( uint32_t dividend, uint32_t divisor )
+{
+    SIO->DIV_UDIVIDEND = dividend;
+    SIO->DIV_UDIVISOR  = divisor;
+    while ( SIO->DIV_CSR_b.READY == 0 );    // result is ready after 8 cycles
+    return ( SIO->DIV_QUOTIENT );
+}
+
+/* SysTick as a free running 24 bit down counter of clk_sys cycles */
+static void cycleCounterStart( void )
+{
+    PPB->SYST_RVR = 0x00FFFFFF;                      // max reload value
+    PPB->SYST_CVR = 0;                               // clear the current value
+    PPB->SYST_CSR = ( ( 1 << 2 ) | ( 1 << 0 ) );     // source clock = processor clock / enable (no interrupt)
+}
+
+/* Hot code: executed from the flash, reads the hot table */
+__xip_hot_func static uint32_t hotWork( void )
+{
+    uint32_t sum = 0;
+
+    for ( uint32_t loop = 0; loop < HOT_LOOPS; loop++ )
+    {
+        for ( uint32_t idx = 0; idx < HOT_TABLE_WORDS; idx++ )
+        {
+            sum += hotTable[idx];
+        }
+    }
+    return ( sum );
+}
+
+/* Plain word copy (memcpy) through the cached XIP alias */
+static void memcpyWords( const uint32_t *pSrc, uint32_t *pDst, uint32_t words )
+{
+    while ( words-- )
+    {
+        *pDst++ = *pSrc++;
+    }
+}
+
+/* Checksum of the destination buffer, to check that both methods read the same data */
+static uint32_t bufferChecksum( void )
+{
+    uint32_t sum = 0;
+
+    for ( uint32_t idx = 0; idx < BULK_WORDS; idx++ )
+    {
+        sum += bulkBuffer[idx];
+    }
+    return ( sum );
+}
+
+/* Print the cycles and bandwidth of a bulk read, and the cache hit rate of the hot code after it */
+static void report( unsigned char *label, uint32_t cycles )
+{
+    uartTxStr( label );
+    uartPrintDec( cycles );
+    uartTxStr( " cycles -> " );
+    uartPrintDec( hwDivide( BULK_SIZE * ( CLK_SYS_HZ / 1000 ), cycles ) );   // bytes / ms = KB/s
+    uartTxStr( " KB/s, checksum " );
+    uartPrintDW( bufferChecksum() );
+
+    // hot code after the bulk read: still in the cache?
+    xipCacheCountersReset();
+    readChecksum = hotWork();
+    uartTxStr( "  hot code after it: " );
+    xipCachePrintStats();
+}
+
+/* ***********************************************
+ * Main function
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    uint32_t start;
+    uint32_t cycles;
+
+    copySection( __data_load__, __data_start__, __data_end__ );
+
+    // Setup clocks (XOSC as source clk)
+    setupClocks();
+    // Reset Subsystems (IO / PADS / DMA)
+    resetSubsys();
+    // Config UART0 (9600 8N1)
+    uartConfig();
+    // Config LED
+    ledConfig();
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "Bulk flash read: memcpy vs XIP stream + DMA (16KB)\r\n\n" );
+
+    cycleCounterStart();
+
+    // memcpy through the cache: every line of the bulk data is allocated
+    xipCacheFlush();
+    readChecksum = hotWork();                           // hot code in the cache
+    start = PPB->SYST_CVR;
+    memcpyWords( ( const uint32_t * ) BULK_ADDR, bulkBuffer, BULK_WORDS );
+    cycles = ( start - PPB->SYST_CVR ) & 0x00FFFFFF;    // SysTick counts down
+    report( "memcpy (0x10000000):  ", cycles );
+
+    // XIP stream + DMA: the cache is not used
+    xipCacheFlush();
+    readChecksum = hotWork();                           // hot code in the cache
+    start = PPB->SYST_CVR;
+    flashStreamRead( ( const void * ) BULK_ADDR, bulkBuffer, BULK_WORDS );
+    cycles = ( start - PPB->SYST_CVR ) & 0x00FFFFFF;
+    report( "XIP stream + DMA:     ", cycles );
+
+    while( true )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+        delaySec( 1 );
+    }
+
+    return ( 0 );
+}
@@ -0,0 +1,17 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+
+#ifndef flash_stream_0
+#define flash_stream_0
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FLASH_STREAM_MAX_WORDS  ( 0x003FFFFF )   // STREAM_CTR is 22 bits
+
+void flashStreamStart( const void *pFlash, uint32_t *pDst, uint32_t words );
+bool flashStreamBusy( void );
+void flashStreamWait( void );
+void flashStreamRead( const void *pFlash, uint32_t *pDst, uint32_t words );
+
+#endif
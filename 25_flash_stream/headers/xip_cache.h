@@ -0,0 +1,40 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+
+#ifndef xip_cache_0
+#define xip_cache_0
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define XIP_CACHE_SIZE        ( 16 * 1024 )    // 2 ways x 8KB
+#define XIP_CACHE_LINE        ( 8 )            // bytes per cache line
+
+/* XIP aliases of the same flash address */
+#define XIP_BASE              ( 0x10000000 )   // cached, allocating
+#define XIP_NOALLOC_BASE      ( 0x11000000 )   // cached, not allocating: hits are used, misses do not evict
+#define XIP_NOCACHE_BASE      ( 0x12000000 )   // not cached, allocating
+#define XIP_NOCACHE_NOALLOC_BASE ( 0x13000000 ) // not cached, not allocating
+#define XIP_SRAM_BASE         ( 0x15000000 )   // cache data memory, when the cache is disabled
+
+/* Address of a flash location (0x10xxxxxx) on the not allocating alias */
+#define XIP_NOALLOC( addr )   ( ( ( uint32_t ) ( addr ) & 0x00FFFFFF ) | XIP_NOALLOC_BASE )
+
+/* Functions and constants used very often: placed together on the flash (memmap.ld) */
+#define __xip_hot_func        __attribute__( ( section( ".xip_hot.text" ) ) )
+#define __xip_hot_data        __attribute__( ( section( ".xip_hot.rodata" ) ) )
+
+void      xipCacheEnable( void );
+void      xipCacheDisable( void );
+bool      xipCacheIsEnabled( void );
+void      xipCacheFlush( void );
+void      xipCachePreload( const void *pStart, uint32_t size );
+void      xipCachePreloadHot( void );
+uint32_t *xipCacheAsSram( void );
+
+void      xipCacheCountersReset( void );
+uint32_t  xipCacheHits( void );
+uint32_t  xipCacheAccesses( void );
+void      xipCachePrintStats( void );
+
+#endif
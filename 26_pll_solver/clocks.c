@@ -0,0 +1,172 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include "clocks.h"
+
+/* Presets are checked at compile time */
+PLL_CONFIG_CHECK( "PLL_SYS_125MHZ", PLL_SYS_125MHZ );
+PLL_CONFIG_CHECK( "PLL_SYS_133MHZ", PLL_SYS_133MHZ );
+PLL_CONFIG_CHECK( "PLL_USB_48MHZ",  PLL_USB_48MHZ );
+
+/* Current frequency of every clock (kHz), updated by the functions that change them */
+static uint32_t clockKhz[CLOCK_COUNT];
+
+/* Unsigned division with the SIO hardware divider (the Cortex-M0+ has no divide instruction),
+   shared by the drivers of this example */
+uint32_t clocksDivide( uint32_t dividend, uint32_t divisor )
+{
+    SIO->DIV_UDIVIDEND = dividend;
+    SIO->DIV_UDIVISOR  = divisor;
+    while ( SIO->DIV_CSR_b.READY == 0 );    // result is ready after 8 cycles
+    return ( SIO->DIV_QUOTIENT );
+}
+
+/* VCO frequency of a PLL configuration (kHz) */
+uint32_t pllVcoKhz( const pllConfig_t *pConfig )
+{
+    return ( clocksDivide( XOSC_KHZ, pConfig->refdiv ) * pConfig->fbdiv );
+}
+
+/* Output frequency of a PLL configuration (kHz) */
+uint32_t pllOutKhz( const pllConfig_t *pConfig )
+{
+    return ( clocksDivide( pllVcoKhz( pConfig ), pConfig->postdiv1 * pConfig->postdiv2 ) );
+}
+
+/* Find the PLL configuration closest to targetKhz. For the same output, the highest VCO
+   frequency (lowest jitter) and REFDIV = 1 are preferred.
+   Returns true if the output is exactly targetKhz */
+bool pllSolve( uint32_t targetKhz, pllConfig_t *pConfig )
+{
+    uint32_t bestError = 0xFFFFFFFF;
+
+    for ( uint32_t refdiv = 1; clocksDivide( XOSC_KHZ, refdiv ) >= PLL_REF_MIN_KHZ; refdiv++ )
+    {
+        uint32_t refKhz = clocksDivide( XOSC_KHZ, refdiv );
+
+        for ( uint32_t fbdiv = PLL_FBDIV_MAX; fbdiv >= PLL_FBDIV_MIN; fbdiv-- )
+        {
+            uint32_t vcoKhz = refKhz * fbdiv;
+
+            if ( ( vcoKhz < PLL_VCO_MIN_KHZ ) || ( vcoKhz > PLL_VCO_MAX_KHZ ) )
+            {
+                continue;
+            }
+            for ( uint32_t pd1 = PLL_POSTDIV_MAX; pd1 >= 1; pd1-- )
+            {
+                for ( uint32_t pd2 = 1; pd2 <= pd1; pd2++ )
+                {
+                    uint32_t outKhz = clocksDivide( vcoKhz, pd1 * pd2 );
+                    uint32_t error  = ( outKhz > targetKhz ) ? ( outKhz - targetKhz ) : ( targetKhz - outKhz );
+
+                    // exact: the division had no remainder
+                    if ( ( error == 0 ) && ( ( outKhz * pd1 * pd2 ) != vcoKhz ) )
+                    {
+                        error = 1;
+                    }
+                    if ( error < bestError )
+                    {
+                        bestError         = error;
+                        pConfig->refdiv   = refdiv;
+                        pConfig->fbdiv    = fbdiv;
+                        pConfig->postdiv1 = pd1;
+                        pConfig->postdiv2 = pd2;
+                        if ( error == 0 )
+                        {
+                            return ( true );
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return ( false );
+}
+
+/* Reset, configure and lock a PLL (PLL_SYS or PLL_USB). It must not be the source of any clock */
+static void pllInit( PLL_SYS_Type *pPll, uint32_t resetMask, const pllConfig_t *pConfig )
+{
+    // PLL_xxx_CLR alias
+    PLL_SYS_Type *pPllClr = ( PLL_SYS_Type * ) ( ( uint32_t ) pPll + 0x3000 );
+
+    RESETS_SET->RESET = resetMask;
+    RESETS_CLR->RESET = resetMask;
+    while ( ( RESETS->RESET_DONE & resetMask ) == 0 );
+
+    pPll->CS        = ( pConfig->refdiv << PLL_SYS_CS_REFDIV_Pos );
+    pPll->FBDIV_INT = pConfig->fbdiv;
+    pPllClr->PWR    = ( ( 1 << PLL_SYS_PWR_PD_Pos ) |                   // Power up the PLL and the VCO
+                        ( 1 << PLL_SYS_PWR_VCOPD_Pos ) );
+    while ( pPll->CS_b.LOCK == 0 );                                     // VCO locked?
+
+    pPll->PRIM   = ( ( pConfig->postdiv1 << PLL_SYS_PRIM_POSTDIV1_Pos ) |
+                     ( pConfig->postdiv2 << PLL_SYS_PRIM_POSTDIV2_Pos ) );
+    pPllClr->PWR = ( 1 << PLL_SYS_PWR_POSTDIVPD_Pos );                  // Power up the post dividers
+}
+
+/* XOSC as clk_ref, clk_sys and clk_peri */
+void clocksInit( void )
+{
+    // Enable the XOSC
+    XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+    XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+    XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+    while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+
+    // No startup code clears .bss: the model starts here
+    for ( uint32_t idx = 0; idx < CLOCK_COUNT; idx++ )
+    {
+        clockKhz[idx] = 0;
+    }
+    clockKhz[CLOCK_XOSC] = XOSC_KHZ;
+    clockKhz[CLOCK_REF]  = XOSC_KHZ;
+    clockKhz[CLOCK_SYS]  = XOSC_KHZ;
+    clockKhz[CLOCK_PERI] = XOSC_KHZ;
+}
+
+/* PLL_SYS as clk_sys. The switch is glitch free: clk_sys runs from clk_ref while the PLL changes */
+void clocksSetSys( const pllConfig_t *pConfig )
+{
+    // clk_sys back to clk_ref (glitchless mux), so the PLL can be stopped
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;                                         // CLK SYS source = clk_ref
+    while ( CLOCKS->CLK_SYS_SELECTED != ( 1 << 0 ) );
+    clockKhz[CLOCK_SYS] = clockKhz[CLOCK_REF];
+
+    pllInit( PLL_SYS, RESETS_RESET_pll_sys_Msk, pConfig );
+    clockKhz[CLOCK_PLL_SYS] = pllOutKhz( pConfig );
+
+    // The aux mux is not glitchless: change it only while it is not selected
+    CLOCKS->CLK_SYS_CTRL_b.AUXSRC = 0;                                      // CLK SYS AUX = pll_sys
+    CLOCKS->CLK_SYS_CTRL_b.SRC    = 1;                                      // CLK SYS source = clk_sys_aux
+    while ( CLOCKS->CLK_SYS_SELECTED != ( 1 << 1 ) );
+    clockKhz[CLOCK_SYS] = clockKhz[CLOCK_PLL_SYS];
+}
+
+/* PLL_USB as clk_usb (48MHz for the USB controller) */
+void clocksSetUsb( const pllConfig_t *pConfig )
+{
+    CLOCKS_CLR->CLK_USB_CTRL = CLOCKS_CLK_USB_CTRL_ENABLE_Msk;              // stop clk_usb
+    clockKhz[CLOCK_USB] = 0;
+
+    pllInit( PLL_USB, RESETS_RESET_pll_usb_Msk, pConfig );
+    clockKhz[CLOCK_PLL_USB] = pllOutKhz( pConfig );
+
+    CLOCKS->CLK_USB_CTRL_b.AUXSRC = 0;                                      // CLK USB AUX = pll_usb
+    CLOCKS->CLK_USB_DIV_b.INT     = 1;
+    CLOCKS_SET->CLK_USB_CTRL = CLOCKS_CLK_USB_CTRL_ENABLE_Msk;
+    clockKhz[CLOCK_USB] = clockKhz[CLOCK_PLL_USB];
+}
+
+/* Frequency of a clock (kHz), 0 if it is stopped. For the drivers that depend on it (UART, I2C, delays...) */
+uint32_t clocksGetKhz( uint32_t clock )
+{
+    return ( ( clock < CLOCK_COUNT ) ? clockKhz[clock] : 0 );
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+
+#ifndef clocks_0
+#define clocks_0
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Limits of the PLL (RP2040 datasheet, 2.18.2) */
+#define XOSC_KHZ             ( 12000 )
+#define PLL_REF_MIN_KHZ      ( 5000 )      // reference after REFDIV
+#define PLL_VCO_MIN_KHZ      ( 750000 )
+#define PLL_VCO_MAX_KHZ      ( 1600000 )
+#define PLL_FBDIV_MIN        ( 16 )
+#define PLL_FBDIV_MAX        ( 320 )
+#define PLL_POSTDIV_MAX      ( 7 )
+
+/* Clocks whose frequency is known by the driver */
+#define CLOCK_XOSC           ( 0 )
+#define CLOCK_PLL_SYS        ( 1 )
+#define CLOCK_PLL_USB        ( 2 )
+#define CLOCK_REF            ( 3 )
+#define CLOCK_SYS            ( 4 )
+#define CLOCK_PERI           ( 5 )
+#define CLOCK_USB            ( 6 )
+#define CLOCK_COUNT          ( 7 )
+
+typedef struct
+{
+    uint32_t refdiv;
+    uint32_t fbdiv;
+    uint32_t postdiv1;
+    uint32_t postdiv2;
+} pllConfig_t;
+
+/* Compile time PLL configuration ( REFDIV, FBDIV, POSTDIV1, POSTDIV2 ), checked by the compiler:
+   static const pllConfig_t cfg = { PLL_SYS_125MHZ };
+   PLL_CONFIG_CHECK( "PLL_SYS_125MHZ", PLL_SYS_125MHZ ); */
+#define PLL_SYS_125MHZ       1, 125, 6, 2    // 1500MHz / 6 / 2
+#define PLL_SYS_133MHZ       1, 133, 6, 2    // 1596MHz / 6 / 2
+#define PLL_USB_48MHZ        1, 120, 6, 5    // 1440MHz / 6 / 5
+
+#define PLL_VCO_KHZ( refdiv, fbdiv )             ( ( XOSC_KHZ / ( refdiv ) ) * ( fbdiv ) )
+#define PLL_OUT_KHZ( refdiv, fbdiv, pd1, pd2 )   ( PLL_VCO_KHZ( refdiv, fbdiv ) / ( ( pd1 ) * ( pd2 ) ) )
+#define PLL_CONFIG_CHECK( name, ... )            PLL_CONFIG_CHECK_( name, __VA_ARGS__ )
+#define PLL_CONFIG_CHECK_( name, refdiv, fbdiv, pd1, pd2 )                                                  \
+    _Static_assert( ( XOSC_KHZ / ( refdiv ) ) >= PLL_REF_MIN_KHZ, name ": reference below 5MHz" );          \
+    _Static_assert( ( ( fbdiv ) >= PLL_FBDIV_MIN ) && ( ( fbdiv ) <= PLL_FBDIV_MAX ), name ": FBDIV" );     \
+    _Static_assert( ( PLL_VCO_KHZ( refdiv, fbdiv ) >= PLL_VCO_MIN_KHZ ) &&                                  \
+                    ( PLL_VCO_KHZ( refdiv, fbdiv ) <= PLL_VCO_MAX_KHZ ), name ": VCO out of range" );       \
+    _Static_assert( ( ( pd1 ) >= 1 ) && ( ( pd1 ) <= PLL_POSTDIV_MAX ) &&                                   \
+                    ( ( pd2 ) >= 1 ) && ( ( pd2 ) <= ( pd1 ) ), name ": POSTDIV" )
+
+bool     pllSolve( uint32_t targetKhz, pllConfig_t *pConfig );
+uint32_t pllVcoKhz( const pllConfig_t *pConfig );
+uint32_t pllOutKhz( const pllConfig_t *pConfig );
+uint32_t clocksDivide( uint32_t dividend, uint32_t divisor );
+void     clocksInit( void );
+void     clocksSetSys( const pllConfig_t *pConfig );
+void     clocksSetUsb( const pllConfig_t *pConfig );
+uint32_t clocksGetKhz( uint32_t clock );
+
+#endif
@@ -0,0 +1,112 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+#include "clocks.h"
+
+/* clk_sys frequencies to try (kHz) */
+static const uint32_t targetKhz[] = { 125000, 133000, 48000, 123456 };
+
+/* PLL_USB: compile time configuration, checked by the compiler */
+static const pllConfig_t usbConfig = { PLL_USB_48MHZ };
+PLL_CONFIG_CHECK( "usbConfig", PLL_USB_48MHZ );
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+}
+
+/* configure LED */
+void ledConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+}
+
+/* Approximate delay, at any clk_sys (a loop takes ~8 cycles at -O0) */
+void delayMs( uint32_t ms )
+{
+    uint32_t loopsPerMs = clocksGetKhz( CLOCK_SYS ) >> 3;
+
+    for ( volatile uint32_t x = 0; x < ( ms * loopsPerMs ); x++ );
+}
+
+/* Print a PLL configuration and its frequencies */
+static void printPll( const pllConfig_t *pConfig )
+{
+    uartTxStr( "REFDIV " );
+    uartPrintDec( pConfig->refdiv );
+    uartTxStr( " FBDIV " );
+    uartPrintDec( pConfig->fbdiv );
+    uartTxStr( " POSTDIV " );
+    uartPrintDec( pConfig->postdiv1 );
+    uartTxStr( "/" );
+    uartPrintDec( pConfig->postdiv2 );
+    uartTxStr( " VCO " );
+    uartPrintDec( pllVcoKhz( pConfig ) );
+    uartTxStr( " kHz -> " );
+    uartPrintDec( pllOutKhz( pConfig ) );
+    uartTxStr( " kHz\r\n" );
+}
+
+/* ***********************************************
+ * Main function
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    pllConfig_t config;
+
+    // Setup clocks (XOSC as source clk)
+    clocksInit();
+    // Reset Subsystems (IO / PADS)
+    resetSubsys();
+    // Config UART0 (9600 8N1): clk_peri stays on the XOSC
+    uartConfig();
+    // Config LED
+    ledConfig();
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "PLL configuration solver\r\n\n" );
+
+    // PLL_USB from the compile time preset, compared with the solver
+    clocksSetUsb( &usbConfig );
+    uartTxStr( "PLL_USB preset: " );
+    printPll( &usbConfig );
+    pllSolve( 48000, &config );
+    uartTxStr( "PLL_USB solver: " );
+    printPll( &config );
+    uartTxStr( "clk_usb: " );
+    uartPrintDec( clocksGetKhz( CLOCK_USB ) );
+    uartTxStr( " kHz\r\n\n" );
+
+    while( true )
+    {
+        for ( uint32_t idx = 0; idx < ( sizeof( targetKhz ) / sizeof( targetKhz[0] ) ); idx++ )
+        {
+            uartTxStr( "clk_sys target " );
+            uartPrintDec( targetKhz[idx] );
+            uartTxStr( pllSolve( targetKhz[idx], &config ) ? " kHz (exact): " : " kHz (closest): " );
+            printPll( &config );
+
+            clocksSetSys( &config );
+
+            // The delay follows clk_sys: the LED blinks at the same speed at every frequency
+            for ( uint32_t blink = 0; blink < 6; blink++ )
+            {
+                SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+                delayMs( 250 );
+            }
+        }
+    }
+
+    return ( 0 );
+}
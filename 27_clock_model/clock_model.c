@@ -0,0 +1,205 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include <stdbool.h>
+#include "uart.h"
+#include "i2c.h"
+#include "clocks.h"
+
+#define BLINK_MS   ( 250 )
+#define TICK_MS    ( 50 )      // SysTick period: 250ms does not fit in 24 bits above 67MHz
+
+/* Baud rates checked against the clock model */
+static const uint32_t uartBauds[] = { 9600, 115200, 921600, 3000000 };
+static const uint32_t i2cBauds[]  = { 100000, 400000, 1000000 };
+
+/* reset the subsystems used in this program */
+static void resetSubsys( void )
+{
+    // Reset IO Bank
+    RESETS_CLR->RESET_b.io_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.io_bank0 == 0 );
+
+    // Reset PADS BANK
+    RESETS_CLR->RESET_b.pads_bank0 = 1;
+    while ( RESETS->RESET_DONE_b.pads_bank0 == 0 );
+}
+
+/* configure LED */
+void ledConfig( void )
+{
+    // Set GPIO25 as SIO (F5) and GPIO OE
+    IO_BANK0->GPIO25_CTRL_b.FUNCSEL = 5;
+    SIO->GPIO_OE_SET_b.GPIO_OE_SET = ( 1 << 25 );
+}
+
+/* Clock change listener: nothing may be on the wire while the clock changes, and the divisors
+   follow the new frequency */
+static void onClockChange( uint32_t event )
+{
+    if ( event == CLOCK_EVENT_PRE )
+    {
+        uartFlush();
+        while ( I2C0->IC_STATUS_b.ACTIVITY != 0 );
+    }
+    else
+    {
+        uartSetBaud( UART_BAUD );
+        i2c0SetBaud( I2C_BAUD );
+    }
+}
+
+/* Print the result of a divisor calculation that failed */
+static void printStatus( uint32_t status )
+{
+    uartTxStr( ( status == CLOCK_ERR_STOPPED ) ? "clock stopped\r\n" : "out of range\r\n" );
+}
+
+/* Print a value in 0.01 units as x.xx */
+static void printX100( uint32_t value )
+{
+    uint32_t integer = clocksDivide( value, 100 );
+    uint32_t frac    = value - ( integer * 100 );
+
+    uartPrintDec( integer );
+    uartTxStr( ( frac < 10 ) ? ".0" : "." );
+    uartPrintDec( frac );
+}
+
+/* Print every timing constant derived from the current clocks */
+static void printModel( void )
+{
+    uint32_t    divisor;
+    uint32_t    errorX100;
+    uint32_t    reload;
+    uint32_t    status;
+    i2cTiming_t timing;
+
+    uartTxStr( "clk_sys " );
+    uartPrintDec( clocksGetKhz( CLOCK_SYS ) );
+    uartTxStr( " kHz, clk_peri " );
+    uartPrintDec( clocksGetKhz( CLOCK_PERI ) );
+    uartTxStr( " kHz\r\n" );
+
+    for ( uint32_t idx = 0; idx < ( sizeof( uartBauds ) / sizeof( uartBauds[0] ) ); idx++ )
+    {
+        uartTxStr( "  UART " );
+        uartPrintDec( uartBauds[idx] );
+        uartTxStr( ": " );
+        status = uartBaudCalc( uartBauds[idx], &divisor, &errorX100 );
+        if ( status != CLOCK_OK )
+        {
+            printStatus( status );
+            continue;
+        }
+        uartTxStr( "IBRD " );
+        uartPrintDec( divisor >> 6 );
+        uartTxStr( " FBRD " );
+        uartPrintDec( divisor & 0x3F );
+        uartTxStr( " error " );
+        printX100( errorX100 );
+        uartTxStr( "%\r\n" );
+    }
+
+    for ( uint32_t idx = 0; idx < ( sizeof( i2cBauds ) / sizeof( i2cBauds[0] ) ); idx++ )
+    {
+        uartTxStr( "  I2C  " );
+        uartPrintDec( i2cBauds[idx] );
+        uartTxStr( ": " );
+        status = i2cTimingCalc( i2cBauds[idx], &timing );
+        if ( status != CLOCK_OK )
+        {
+            printStatus( status );
+            continue;
+        }
+        uartTxStr( "HCNT " );
+        uartPrintDec( timing.hcnt );
+        uartTxStr( " LCNT " );
+        uartPrintDec( timing.lcnt );
+        uartTxStr( " SPKLEN " );
+        uartPrintDec( timing.spklen );
+        uartTxStr( " SDA_HOLD " );
+        uartPrintDec( timing.sdaHold );
+        uartTxStr( "\r\n" );
+    }
+
+    uartTxStr( "  SysTick 250ms: " );
+    status = clocksSysTickReload( 250, &reload );
+    if ( status != CLOCK_OK )
+    {
+        printStatus( status );
+    }
+    else
+    {
+        uartPrintDec( reload );
+        uartTxStr( "\r\n" );
+    }
+    uartTxStr( "\r\n" );
+}
+
+/* SysTick as a periodic timer of TICK_MS (no interrupt: COUNTFLAG is polled) */
+static void sysTickStart( void )
+{
+    uint32_t reload;
+
+    if ( clocksSysTickReload( TICK_MS, &reload ) != CLOCK_OK )
+    {
+        uartTxStr( "SysTick period out of range\r\n" );
+        return;
+    }
+    PPB->SYST_CSR = 0;
+    PPB->SYST_RVR = reload;
+    PPB->SYST_CVR = 0;                               // clear the current value
+    PPB->SYST_CSR = ( ( 1 << 2 ) | ( 1 << 0 ) );     // source clock = processor clock / enable (no interrupt)
+}
+
+/* Wait for a number of SysTick periods */
+static void sysTickWait( uint32_t ticks )
+{
+    while ( ticks-- != 0 )
+    {
+        while ( PPB->SYST_CSR_b.COUNTFLAG == 0 );    // cleared by the read
+    }
+}
+
+/* ***********************************************
+ * Main function
+ * ********************************************* */
+__attribute__( ( used, section( ".boot.entry" ) ) ) int main( void )
+{
+    pllConfig_t config;
+
+    // Setup clocks (XOSC as source clk)
+    clocksInit();
+    // Reset Subsystems (IO / PADS)
+    resetSubsys();
+    // Config UART0 (9600 8N1) and I2C0 (400kHz): divisors from the clock model
+    uartConfig();
+    i2c0Config();
+    clocksAddListener( onClockChange );
+    // Config LED
+    ledConfig();
+
+    uartTxStr( "\r\n\n-- RPi Pico Baremetal --\r\n\n" );
+    uartTxStr( "Clock model: timing constants derived from the clock frequencies\r\n\n" );
+    printModel();
+
+    // clk_peri follows clk_sys: UART and I2C run from the PLL, the listener derives the divisors again
+    clocksSetPeri( CLOCK_PERI_FROM_SYS );
+    pllSolve( 125000, &config );
+    clocksSetSys( &config );
+    printModel();
+
+    sysTickStart();
+    uartTxStr( "TIMER delay ( 1s ): " );
+    clocksDelayUs( 1000000 );
+    uartTxStr( "done\r\n" );
+
+    while( true )
+    {
+        SIO->GPIO_OUT_XOR_b.GPIO_OUT_XOR = ( 1 << 25 );     // XOR the LED pin
+        sysTickWait( BLINK_MS / TICK_MS );
+    }
+
+    return ( 0 );
+}
@@ -0,0 +1,285 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include "clocks.h"
+
+/* Presets are checked at compile time */
+PLL_CONFIG_CHECK( "PLL_SYS_125MHZ", PLL_SYS_125MHZ );
+PLL_CONFIG_CHECK( "PLL_SYS_133MHZ", PLL_SYS_133MHZ );
+PLL_CONFIG_CHECK( "PLL_USB_48MHZ",  PLL_USB_48MHZ );
+
+/* Current frequency of every clock (kHz), updated by the functions that change them */
+static uint32_t clockKhz[CLOCK_COUNT];
+
+/* Source of clk_peri (CLOCK_PERI_FROM_x), it follows clk_sys / PLL_SYS / PLL_USB when they change */
+static uint32_t periSource;
+
+/* Drivers notified when a clock changes */
+static clockListener_t listeners[CLOCK_LISTENERS_MAX];
+static uint32_t        listenerCount;
+
+/* Unsigned division with the SIO hardware divider (the Cortex-M0+ has no divide instruction),
+   shared by the drivers of this example */
+uint32_t clocksDivide( uint32_t dividend, uint32_t divisor )
+{
+    SIO->DIV_UDIVIDEND = dividend;
+    SIO->DIV_UDIVISOR  = divisor;
+    while ( SIO->DIV_CSR_b.READY == 0 );    // result is ready after 8 cycles
+    return ( SIO->DIV_QUOTIENT );
+}
+
+/* VCO frequency of a PLL configuration (kHz) */
+uint32_t pllVcoKhz( const pllConfig_t *pConfig )
+{
+    return ( clocksDivide( XOSC_KHZ, pConfig->refdiv ) * pConfig->fbdiv );
+}
+
+/* Output frequency of a PLL configuration (kHz) */
+uint32_t pllOutKhz( const pllConfig_t *pConfig )
+{
+    return ( clocksDivide( pllVcoKhz( pConfig ), pConfig->postdiv1 * pConfig->postdiv2 ) );
+}
+
+/* Find the PLL configuration closest to targetKhz. For the same output, the highest VCO
+   frequency (lowest jitter) and REFDIV = 1 are preferred.
+   Returns true if the output is exactly targetKhz */
+bool pllSolve( uint32_t targetKhz, pllConfig_t *pConfig )
+{
+    uint32_t bestError = 0xFFFFFFFF;
+
+    for ( uint32_t refdiv = 1; clocksDivide( XOSC_KHZ, refdiv ) >= PLL_REF_MIN_KHZ; refdiv++ )
+    {
+        uint32_t refKhz = clocksDivide( XOSC_KHZ, refdiv );
+
+        for ( uint32_t fbdiv = PLL_FBDIV_MAX; fbdiv >= PLL_FBDIV_MIN; fbdiv-- )
+        {
+            uint32_t vcoKhz = refKhz * fbdiv;
+
+            if ( ( vcoKhz < PLL_VCO_MIN_KHZ ) || ( vcoKhz > PLL_VCO_MAX_KHZ ) )
+            {
+                continue;
+            }
+            for ( uint32_t pd1 = PLL_POSTDIV_MAX; pd1 >= 1; pd1-- )
+            {
+                for ( uint32_t pd2 = 1; pd2 <= pd1; pd2++ )
+                {
+                    uint32_t outKhz = clocksDivide( vcoKhz, pd1 * pd2 );
+                    uint32_t error  = ( outKhz > targetKhz ) ? ( outKhz - targetKhz ) : ( targetKhz - outKhz );
+
+                    // exact: the division had no remainder
+                    if ( ( error == 0 ) && ( ( outKhz * pd1 * pd2 ) != vcoKhz ) )
+                    {
+                        error = 1;
+                    }
+                    if ( error < bestError )
+                    {
+                        bestError         = error;
+                        pConfig->refdiv   = refdiv;
+                        pConfig->fbdiv    = fbdiv;
+                        pConfig->postdiv1 = pd1;
+                        pConfig->postdiv2 = pd2;
+                        if ( error == 0 )
+                        {
+                            return ( true );
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return ( false );
+}
+
+/* Call every listener with a clock change event */
+static void clocksNotify( uint32_t event )
+{
+    for ( uint32_t idx = 0; idx < listenerCount; idx++ )
+    {
+        listeners[idx]( event );
+    }
+}
+
+/* Frequency of clk_peri from its current source (kHz) */
+static uint32_t periSourceKhz( void )
+{
+    switch ( periSource )
+    {
+        case CLOCK_PERI_FROM_SYS:     return ( clockKhz[CLOCK_SYS] );
+        case CLOCK_PERI_FROM_PLL_SYS: return ( clockKhz[CLOCK_PLL_SYS] );
+        case CLOCK_PERI_FROM_PLL_USB: return ( clockKhz[CLOCK_PLL_USB] );
+        case CLOCK_PERI_FROM_XOSC:    return ( clockKhz[CLOCK_XOSC] );
+        default:                      return ( 0 );
+    }
+}
+
+/* Watchdog tick (TIMER time base) from clk_ref: 1us per tick */
+static void tickInit( void )
+{
+    WATCHDOG->TICK = ( WATCHDOG_TICK_ENABLE_Msk |
+                       ( clocksDivide( clockKhz[CLOCK_REF], 1000 ) << WATCHDOG_TICK_CYCLES_Pos ) );
+}
+
+/* Reset, configure and lock a PLL (PLL_SYS or PLL_USB). It must not be the source of any clock */
+static void pllInit( PLL_SYS_Type *pPll, uint32_t resetMask, const pllConfig_t *pConfig )
+{
+    // PLL_xxx_CLR alias
+    PLL_SYS_Type *pPllClr = ( PLL_SYS_Type * ) ( ( uint32_t ) pPll + 0x3000 );
+
+    RESETS_SET->RESET = resetMask;
+    RESETS_CLR->RESET = resetMask;
+    while ( ( RESETS->RESET_DONE & resetMask ) == 0 );
+
+    pPll->CS        = ( pConfig->refdiv << PLL_SYS_CS_REFDIV_Pos );
+    pPll->FBDIV_INT = pConfig->fbdiv;
+    pPllClr->PWR    = ( ( 1 << PLL_SYS_PWR_PD_Pos ) |                   // Power up the PLL and the VCO
+                        ( 1 << PLL_SYS_PWR_VCOPD_Pos ) );
+    while ( pPll->CS_b.LOCK == 0 );                                     // VCO locked?
+
+    pPll->PRIM   = ( ( pConfig->postdiv1 << PLL_SYS_PRIM_POSTDIV1_Pos ) |
+                     ( pConfig->postdiv2 << PLL_SYS_PRIM_POSTDIV2_Pos ) );
+    pPllClr->PWR = ( 1 << PLL_SYS_PWR_POSTDIVPD_Pos );                  // Power up the post dividers
+}
+
+/* XOSC as clk_ref, clk_sys and clk_peri */
+void clocksInit( void )
+{
+    // Enable the XOSC
+    XOSC->CTRL            = 0xAA0;          // Frequency range: 1_15MHZ
+    XOSC->STARTUP_b.DELAY = 0xC4;           // Startup delay ( default value )
+    XOSC_SET->CTRL        = 0xFAB000;       // Enable ( magic word )
+    while( !(XOSC->STATUS_b.STABLE & 1 ) ); // Oscillator is running and stable
+
+    // Set the XOSC as source clock for REF, SYS and Periferals
+    CLOCKS->CLK_REF_CTRL_b.SRC = 2;         // CLK REF source = xosc_clksrc
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;         // CLK SYS source = clk_ref
+    CLOCKS->CLK_REF_DIV_b.INT  = 1;         // CLK REF Divisor = 1
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = 4;     // CLK PERI AUX SRC = xosc_clksrc
+    CLOCKS->CLK_PERI_CTRL_b.ENABLE = 1;     // CLK PERI Enable
+
+    // No startup code clears .bss: the model starts here
+    for ( uint32_t idx = 0; idx < CLOCK_COUNT; idx++ )
+    {
+        clockKhz[idx] = 0;
+    }
+    listenerCount        = 0;
+    clockKhz[CLOCK_XOSC] = XOSC_KHZ;
+    clockKhz[CLOCK_REF]  = XOSC_KHZ;
+    clockKhz[CLOCK_SYS]  = XOSC_KHZ;
+    clockKhz[CLOCK_PERI] = XOSC_KHZ;
+    periSource           = CLOCK_PERI_FROM_XOSC;
+
+    // TIMER counts microseconds of clk_ref
+    tickInit();
+    RESETS_CLR->RESET_b.timer = 1;
+    while ( RESETS->RESET_DONE_b.timer == 0 );
+}
+
+/* PLL_SYS as clk_sys. The switch is glitch free: clk_sys runs from clk_ref while the PLL changes */
+void clocksSetSys( const pllConfig_t *pConfig )
+{
+    clocksNotify( CLOCK_EVENT_PRE );
+
+    // clk_sys back to clk_ref (glitchless mux), so the PLL can be stopped
+    CLOCKS->CLK_SYS_CTRL_b.SRC = 0;                                         // CLK SYS source = clk_ref
+    while ( CLOCKS->CLK_SYS_SELECTED != ( 1 << 0 ) );
+    clockKhz[CLOCK_SYS] = clockKhz[CLOCK_REF];
+
+    pllInit( PLL_SYS, RESETS_RESET_pll_sys_Msk, pConfig );
+    clockKhz[CLOCK_PLL_SYS] = pllOutKhz( pConfig );
+
+    // The aux mux is not glitchless: change it only while it is not selected
+    CLOCKS->CLK_SYS_CTRL_b.AUXSRC = 0;                                      // CLK SYS AUX = pll_sys
+    CLOCKS->CLK_SYS_CTRL_b.SRC    = 1;                                      // CLK SYS source = clk_sys_aux
+    while ( CLOCKS->CLK_SYS_SELECTED != ( 1 << 1 ) );
+    clockKhz[CLOCK_SYS]  = clockKhz[CLOCK_PLL_SYS];
+    clockKhz[CLOCK_PERI] = periSourceKhz();
+
+    clocksNotify( CLOCK_EVENT_POST );
+}
+
+/* PLL_USB as clk_usb (48MHz for the USB controller) */
+void clocksSetUsb( const pllConfig_t *pConfig )
+{
+    clocksNotify( CLOCK_EVENT_PRE );
+
+    CLOCKS_CLR->CLK_USB_CTRL = CLOCKS_CLK_USB_CTRL_ENABLE_Msk;              // stop clk_usb
+    clockKhz[CLOCK_USB] = 0;
+
+    pllInit( PLL_USB, RESETS_RESET_pll_usb_Msk, pConfig );
+    clockKhz[CLOCK_PLL_USB] = pllOutKhz( pConfig );
+
+    CLOCKS->CLK_USB_CTRL_b.AUXSRC = 0;                                      // CLK USB AUX = pll_usb
+    CLOCKS->CLK_USB_DIV_b.INT     = 1;
+    CLOCKS_SET->CLK_USB_CTRL = CLOCKS_CLK_USB_CTRL_ENABLE_Msk;
+    clockKhz[CLOCK_USB]  = clockKhz[CLOCK_PLL_USB];
+    clockKhz[CLOCK_PERI] = periSourceKhz();
+
+    clocksNotify( CLOCK_EVENT_POST );
+}
+
+/* Select the clk_peri source (CLOCK_PERI_FROM_x). The aux mux is not glitchless: clk_peri is stopped
+   while it changes */
+void clocksSetPeri( uint32_t source )
+{
+    clocksNotify( CLOCK_EVENT_PRE );
+
+    CLOCKS_CLR->CLK_PERI_CTRL = CLOCKS_CLK_PERI_CTRL_ENABLE_Msk;            // stop clk_peri
+    for ( volatile uint32_t x = 0; x < 3; x++ );                            // 2 cycles of the old source
+    CLOCKS->CLK_PERI_CTRL_b.AUXSRC = source;
+    CLOCKS_SET->CLK_PERI_CTRL = CLOCKS_CLK_PERI_CTRL_ENABLE_Msk;
+
+    periSource           = source;
+    clockKhz[CLOCK_PERI] = periSourceKhz();
+
+    clocksNotify( CLOCK_EVENT_POST );
+}
+
+/* Frequency of a clock (kHz), 0 if it is stopped. For the drivers that depend on it (UART, I2C, delays...) */
+uint32_t clocksGetKhz( uint32_t clock )
+{
+    return ( ( clock < CLOCK_COUNT ) ? clockKhz[clock] : 0 );
+}
+
+/* Frequency of a clock (Hz) */
+uint32_t clocksGetHz( uint32_t clock )
+{
+    return ( clocksGetKhz( clock ) * 1000 );
+}
+
+/* Register a driver to be called before and after every clock change. Returns false if the table is full */
+bool clocksAddListener( clockListener_t listener )
+{
+    if ( listenerCount >= CLOCK_LISTENERS_MAX )
+    {
+        return ( false );
+    }
+    listeners[listenerCount++] = listener;
+    return ( true );
+}
+
+/* SysTick reload value for a period of clk_sys cycles. The counter is 24 bits: CLOCK_ERR_RANGE if the
+   period does not fit at the current clk_sys (250ms fits up to 67MHz) */
+uint32_t clocksSysTickReload( uint32_t periodMs, uint32_t *pReload )
+{
+    uint32_t sysKhz = clockKhz[CLOCK_SYS];
+
+    if ( sysKhz == 0 )
+    {
+        return ( CLOCK_ERR_STOPPED );
+    }
+    if ( ( periodMs == 0 ) || ( periodMs > clocksDivide( 0x01000000, sysKhz ) ) )
+    {
+        return ( CLOCK_ERR_RANGE );
+    }
+    *pReload = ( sysKhz * periodMs ) - 1;                                   // counts reload..0
+    return ( CLOCK_OK );
+}
+
+/* Busy wait on the TIMER: the same length at any clk_sys */
+void clocksDelayUs( uint32_t us )
+{
+    uint32_t start = TIMER->TIMERAWL;
+
+    while ( ( TIMER->TIMERAWL - start ) < us );
+}
@@ -0,0 +1,24 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+
+#ifndef i2c0_0
+#define i2c0_0
+
+#include <stdint.h>
+
+#define I2C_BAUD ( 400000 )    // Fast mode
+
+/* SCL timing of a baud rate, in clk_sys cycles */
+typedef struct
+{
+    uint32_t hcnt;
+    uint32_t lcnt;
+    uint32_t spklen;
+    uint32_t sdaHold;
+} i2cTiming_t;
+
+uint32_t i2cTimingCalc( uint32_t baud, i2cTiming_t *pTiming );
+uint32_t i2c0SetBaud( uint32_t baud );
+uint32_t i2c0Config( void );
+
+#endif
@@ -0,0 +1,23 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+
+#ifndef uart0_0
+#define uart0_0
+
+#include <stdint.h>
+
+#define UART_BAUD ( 9600 )
+
+void uartConfig( void );
+unsigned char uartRx( void );
+void uartTx( unsigned char x );
+void uartTxStr( unsigned char *x );
+void uartPrintByte( unsigned char data );
+void uartPrintDW( unsigned int data );
+unsigned char uartRxNoBlocking( void );
+void uartPrintDec( unsigned int data );
+uint32_t uartBaudCalc( uint32_t baud, uint32_t *pDivisor, uint32_t *pErrorX100 );
+uint32_t uartSetBaud( uint32_t baud );
+void uartFlush( void );
+
+#endif
\ No newline at end of file
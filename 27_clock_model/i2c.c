@@ -0,0 +1,92 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include "i2c.h"
+#include "clocks.h"
+
+/* SCL high / low counts for a baud rate at the current clk_sys (the I2C block runs from clk_sys).
+   The period is split 40% high / 60% low (the low time has the tighter minimum), spikes up to 1/16
+   of the low time are filtered and SDA is held 300ns after SCL falls */
+uint32_t i2cTimingCalc( uint32_t baud, i2cTiming_t *pTiming )
+{
+    uint32_t sysHz = clocksGetHz( CLOCK_SYS );
+    uint32_t period;
+
+    if ( sysHz == 0 )
+    {
+        return ( CLOCK_ERR_STOPPED );
+    }
+    if ( ( baud == 0 ) || ( baud > 1000000 ) )
+    {
+        return ( CLOCK_ERR_RANGE );
+    }
+
+    period          = clocksDivide( sysHz + ( baud >> 1 ), baud );
+    pTiming->lcnt   = clocksDivide( period * 3, 5 );
+    pTiming->hcnt   = period - pTiming->lcnt;
+    pTiming->spklen = ( pTiming->lcnt < 16 ) ? 1 : ( pTiming->lcnt >> 4 );
+    pTiming->sdaHold = clocksDivide( sysHz * 3, 10000000 ) + 1;
+
+    // Datasheet limits: HCNT / LCNT 16 bits, LCNT >= SPKLEN + 7, HCNT >= SPKLEN + 5, hold < LCNT - 2
+    if ( ( pTiming->hcnt > 0xFFFF ) || ( pTiming->lcnt > 0xFFFF ) ||
+         ( pTiming->lcnt < ( pTiming->spklen + 7 ) ) || ( pTiming->hcnt < ( pTiming->spklen + 5 ) ) ||
+         ( pTiming->sdaHold >= ( pTiming->lcnt - 2 ) ) )
+    {
+        return ( CLOCK_ERR_RANGE );
+    }
+    return ( CLOCK_OK );
+}
+
+/* Set the I2C0 SCL timing from the clock model. The counts can only be written while I2C0 is disabled */
+uint32_t i2c0SetBaud( uint32_t baud )
+{
+    i2cTiming_t timing;
+    uint32_t    status = i2cTimingCalc( baud, &timing );
+    uint32_t    enabled = I2C0->IC_ENABLE_b.ENABLE;
+
+    if ( status == CLOCK_OK )
+    {
+        I2C0->IC_ENABLE      = 0;
+        I2C0->IC_FS_SCL_HCNT = timing.hcnt;
+        I2C0->IC_FS_SCL_LCNT = timing.lcnt;
+        I2C0->IC_FS_SPKLEN   = timing.spklen;
+        I2C0->IC_SDA_HOLD    = ( timing.sdaHold << I2C0_IC_SDA_HOLD_IC_SDA_TX_HOLD_Pos );
+        I2C0->IC_ENABLE      = enabled;
+    }
+    return ( status );
+}
+
+/* configure i2c0 master at I2C_BAUD, with the counts of the current clk_sys */
+uint32_t i2c0Config( void )
+{
+    uint32_t status;
+
+    RESETS_CLR->RESET_b.i2c0 = 1;
+    while ( RESETS->RESET_DONE_b.i2c0 == 0 );
+
+    // Disable I2C
+    I2C0->IC_ENABLE = 0;
+    // Config Master mode at Fast speed and 7-bit addressing
+    I2C0->IC_CON_b.MASTER_MODE = I2C0_IC_CON_MASTER_MODE_ENABLED;
+    I2C0->IC_CON_b.SPEED = I2C0_IC_CON_SPEED_FAST;
+    I2C0->IC_CON_b.IC_10BITADDR_SLAVE = I2C0_IC_CON_IC_10BITADDR_MASTER_ADDR_7BITS;
+    I2C0->IC_CON_b.IC_10BITADDR_MASTER = I2C0_IC_CON_IC_10BITADDR_SLAVE_ADDR_7BITS;
+    I2C0->IC_CON_b.IC_RESTART_EN = I2C0_IC_CON_IC_RESTART_EN_DISABLED;
+    I2C0->IC_CON_b.IC_SLAVE_DISABLE = I2C0_IC_CON_IC_SLAVE_DISABLE_SLAVE_DISABLED;
+    I2C0->IC_CON_b.STOP_DET_IFADDRESSED = I2C0_IC_CON_STOP_DET_IFADDRESSED_DISABLED;
+    I2C0->IC_CON_b.TX_EMPTY_CTRL = I2C0_IC_CON_TX_EMPTY_CTRL_ENABLED;
+    I2C0->IC_CON_b.RX_FIFO_FULL_HLD_CTRL = I2C0_IC_CON_RX_FIFO_FULL_HLD_CTRL_DISABLED;
+    // High and Low counts from the clock model
+    status = i2c0SetBaud( I2C_BAUD );
+
+    // Set GPIO20 and 21 to function 3 (I2C0)
+    IO_BANK0->GPIO21_CTRL_b.FUNCSEL = 3;
+    IO_BANK0->GPIO20_CTRL_b.FUNCSEL = 3;
+    // Pull Up Enabled (I2C)
+    PADS_BANK0->GPIO21_b.PUE = 1;
+    PADS_BANK0->GPIO20_b.PUE = 1;
+
+    // Enable I2C
+    I2C0->IC_ENABLE = 1;
+    return ( status );
+}
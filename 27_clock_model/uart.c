@@ -0,0 +1,181 @@
+// Copyright (c) 2024 CarlosFTM
+// This code is licensed under MIT license (see LICENSE.txt for details)
+#include "RP2040.h"
+#include "uart.h"
+#include "clocks.h"
+
+/* Baud rate divisor for the current clk_peri: divisor = clk_peri / ( 16 * baud ), in 1/64 steps
+   ( IBRD << 6 | FBRD ). The error of the real baud rate is returned in 0.01% units */
+uint32_t uartBaudCalc( uint32_t baud, uint32_t *pDivisor, uint32_t *pErrorX100 )
+{
+    uint32_t periHz = clocksGetHz( CLOCK_PERI );
+    uint32_t baudDiv;
+    uint32_t ibrd;
+    uint32_t fbrd;
+    uint32_t realBaud;
+    uint32_t diff;
+
+    if ( periHz == 0 )
+    {
+        return ( CLOCK_ERR_STOPPED );
+    }
+    if ( baud == 0 )
+    {
+        return ( CLOCK_ERR_RANGE );
+    }
+
+    // 128 * divisor, rounded to 64ths
+    baudDiv = clocksDivide( periHz * 8, baud );
+    ibrd    = baudDiv >> 7;
+    fbrd    = ( ( baudDiv & 0x7F ) + 1 ) >> 1;
+    if ( fbrd == 64 )
+    {
+        ibrd++;
+        fbrd = 0;
+    }
+    if ( ( ibrd == 0 ) || ( ibrd > 0xFFFF ) )
+    {
+        return ( CLOCK_ERR_RANGE );
+    }
+
+    realBaud = clocksDivide( periHz * 4, ( ibrd << 6 ) | fbrd );
+    diff     = ( realBaud > baud ) ? ( realBaud - baud ) : ( baud - realBaud );
+
+    *pDivisor = ( ( ibrd << 6 ) | fbrd );
+    if ( pErrorX100 != 0 )
+    {
+        *pErrorX100 = clocksDivide( diff * 10000, baud );
+    }
+    return ( CLOCK_OK );
+}
+
+/* Set the UART0 baud rate from the clock model. The divisors are latched by the LCR_H write */
+uint32_t uartSetBaud( uint32_t baud )
+{
+    uint32_t divisor;
+    uint32_t status = uartBaudCalc( baud, &divisor, 0 );
+
+    if ( status == CLOCK_OK )
+    {
+        UART0->UARTIBRD_b.BAUD_DIVINT  = divisor >> 6;
+        UART0->UARTFBRD_b.BAUD_DIVFRAC = divisor & 0x3F;
+        UART0->UARTLCR_H = UART0->UARTLCR_H;
+    }
+    return ( status );
+}
+
+/* Wait until the last character has left the UART (TX FIFO empty and not busy) */
+void uartFlush( void )
+{
+    while ( UART0->UARTFR_b.BUSY != 0 );
+}
+
+/* configures UART0 to UART_BAUD 8N1, with the divisors of the current clk_peri */
+void uartConfig( void )
+{
+    // Reset UART0
+    RESETS_CLR->RESET_b.uart0 = 1;
+    while ( RESETS->RESET_DONE_b.uart0 == 0 );
+
+    uartSetBaud( UART_BAUD );
+    UART0->UARTLCR_H = ( ( 1 << UART0_UARTLCR_H_FEN_Pos ) | ( 3 << UART0_UARTLCR_H_WLEN_Pos ) );
+    UART0->UARTCR = ( ( 1 << UART0_UARTCR_RXE_Pos ) | ( 1 << UART0_UARTCR_TXE_Pos ) | ( 1 << UART0_UARTCR_UARTEN_Pos ) );
+
+    // Set GPIO0 and 1 to function 2 (UART0)
+    IO_BANK0->GPIO0_CTRL_b.FUNCSEL = 2;
+    IO_BANK0->GPIO1_CTRL_b.FUNCSEL = 2;
+}
+
+/* UART receive character */
+unsigned char uartRx( void )
+{
+    while ( UART0->UARTFR_b.RXFE != 0 );           // wait for RX FIFO to not be empty
+    return( ( char )( UART0->UARTDR_b.DATA ) );    // Read the RX data
+}
+
+/* UART Send single character */
+void uartTx( unsigned char x )
+{
+    while( UART0->UARTFR_b.TXFF != 0 );            // wait until TX FIFO is not full
+    UART0->UARTDR_b.DATA = x;                      // Write the TX data
+}
+
+/* UART Send character string */
+void uartTxStr( unsigned char *x )
+{
+    // Write the string of data until the NULL char is detected
+    while( *x != '\0' )
+    {
+        uartTx( *x );
+        x++;
+    }
+}
+
+/* Converts a byte in hex*/
+unsigned char bin2hex(unsigned char input)
+{
+    unsigned char retVal = 'q';
+
+    if ( ( input & 0x0F ) <= 9 )
+    {
+      retVal = ( input & 0x0F ) + '0';
+    }
+    else if ( ( input & 0x0F ) >= 0x0a )
+    {
+      retVal = ( ( input & 0x0F ) - 10 ) + 'a';
+    }
+
+    return retVal;
+}
+
+/* Prints a char (byte) in ASCII */
+void uartByteToAscii( unsigned char data )
+{
+    uartTx( bin2hex( data >> 4 ));
+    uartTx( bin2hex( data ));
+}
+
+/* Prints a char (byte) variable as string */
+void uartPrintByte( unsigned char data )
+{
+    uartTxStr( "[0x" );
+    uartByteToAscii( data );
+    uartTxStr("]\n\r");
+
+}
+
+/* Prints a int (double word) variable as string */
+void uartPrintDW( unsigned int data )
+{
+    uartTxStr( "[0x" );
+    uartByteToAscii( ( char )( ( data & 0xFF000000 ) >> 24 ));
+    uartByteToAscii( ( char )( ( data & 0x00FF0000 ) >> 16 ));
+    uartByteToAscii( ( char )( ( data & 0x0000FF00 ) >>  8 ));
+    uartByteToAscii( ( char )( ( data & 0x000000FF ) >>  0 ));
+    uartTxStr("]\n\r");
+}
+
+/* Prints an unsigned int variable in decimal.
+   The Cortex-M0+ has no divide instruction, so the digits are found by subtraction */
+void uartPrintDec( unsigned int data )
+{
+    static const unsigned int pow10[] = { 1000000000, 100000000, 10000000, 1000000, 100000,
+                                          10000, 1000, 100, 10, 1 };
+    unsigned char digit;
+    int leadingZero = 1;
+
+    for ( int idx = 0; idx < 10; idx++ )
+    {
+        digit = '0';
+        while ( data >= pow10[idx] )
+        {
+            data -= pow10[idx];
+            digit++;
+        }
+        if ( ( digit != '0' ) || ( leadingZero == 0 ) || ( idx == 9 ) )
+        {
+            uartTx( digit );
+            leadingZero = 0;
+        }
+    }
+}
\ No newline at end of file